@@ -0,0 +1,65 @@
+#include "alloc.h"
+#include "export.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+NO_EXPORT
+void *
+mem_alloc(struct allocator const * const alloc, size_t const size)
+{
+	if (alloc == NULL || alloc->ops == NULL) {
+		return malloc(size);
+	}
+
+	return alloc->ops->malloc(alloc->ctx, size);
+}
+
+NO_EXPORT
+void *
+mem_calloc(struct allocator const * const alloc, size_t const count, size_t const size)
+{
+	if (alloc == NULL || alloc->ops == NULL) {
+		return calloc(count, size);
+	}
+
+	size_t total;
+
+	if (__builtin_mul_overflow(count, size, &total)) {
+		return NULL;
+	}
+
+	void * const ptr = alloc->ops->malloc(alloc->ctx, total);
+
+	if (ptr != NULL) {
+		memset(ptr, 0, total);
+	}
+
+	return ptr;
+}
+
+NO_EXPORT
+void *
+mem_realloc(struct allocator const * const alloc, void * const ptr, size_t const size)
+{
+	if (alloc == NULL || alloc->ops == NULL) {
+		return realloc(ptr, size);
+	}
+	/* The allocator's realloc is only given memory that it allocated. */
+	if (ptr == NULL) {
+		return alloc->ops->malloc(alloc->ctx, size);
+	}
+
+	return alloc->ops->realloc(alloc->ctx, ptr, size);
+}
+
+NO_EXPORT
+void
+mem_free(struct allocator const * const alloc, void * const ptr)
+{
+	if (alloc == NULL || alloc->ops == NULL) {
+		free(ptr);
+	} else if (alloc->ops->free != NULL && ptr != NULL) {
+		alloc->ops->free(alloc->ctx, ptr);
+	}
+}
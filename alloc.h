@@ -0,0 +1,27 @@
+#pragma once
+
+#include "minirl.h"
+
+#include <stddef.h>
+
+/*
+ * The allocator that an instance's memory comes from. A NULL allocator, as
+ * found in structures that are zeroed, uses malloc() and free().
+ */
+struct allocator {
+	minirl_allocator_st const *ops;
+	void *ctx;
+};
+
+void *
+mem_alloc(struct allocator const *alloc, size_t size);
+
+/* Allocate 'count' zeroed elements of 'size' bytes. */
+void *
+mem_calloc(struct allocator const *alloc, size_t count, size_t size);
+
+void *
+mem_realloc(struct allocator const *alloc, void *ptr, size_t size);
+
+void
+mem_free(struct allocator const *alloc, void *ptr);
@@ -0,0 +1,119 @@
+#include "ascii.h"
+#include "export.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+#define FIRST_PRINTABLE_ASCII 0x20
+#define LAST_PRINTABLE_ASCII 0x7e
+
+static size_t
+ascii_printable_run_bytes(char const * const s, size_t const len, size_t i)
+{
+	while (i < len
+	       && (unsigned char)s[i] >= FIRST_PRINTABLE_ASCII
+	       && (unsigned char)s[i] <= LAST_PRINTABLE_ASCII) {
+		i++;
+	}
+
+	return i;
+}
+
+#if defined(__SSE2__)
+
+static size_t
+ascii_printable_run_blocks(char const * const s, size_t const len)
+{
+	/*
+	 * Compared as signed bytes, anything with the top bit set is below
+	 * ' ', so the two compares rule out everything but printable ASCII.
+	 */
+	__m128i const below = _mm_set1_epi8(FIRST_PRINTABLE_ASCII - 1);
+	__m128i const above = _mm_set1_epi8(LAST_PRINTABLE_ASCII + 1);
+	size_t i = 0;
+
+	for (; i + 16 <= len; i += 16) {
+		__m128i const v = _mm_loadu_si128((__m128i const *)&s[i]);
+		__m128i const printable =
+			_mm_and_si128(_mm_cmpgt_epi8(v, below), _mm_cmplt_epi8(v, above));
+		unsigned const mask = _mm_movemask_epi8(printable);
+
+		if (mask != 0xffff) {
+			return i + __builtin_ctz(~mask);
+		}
+	}
+
+	return i;
+}
+
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+
+static size_t
+ascii_printable_run_blocks(char const * const s, size_t const len)
+{
+	uint8x16_t const first = vdupq_n_u8(FIRST_PRINTABLE_ASCII);
+	uint8x16_t const last = vdupq_n_u8(LAST_PRINTABLE_ASCII);
+	size_t i = 0;
+
+	for (; i + 16 <= len; i += 16) {
+		uint8x16_t const v = vld1q_u8((uint8_t const *)&s[i]);
+		uint8x16_t const printable =
+			vandq_u8(vcgeq_u8(v, first), vcleq_u8(v, last));
+
+		if (vminvq_u8(printable) == 0) {
+			/* The caller finds which byte ended the run. */
+			return i;
+		}
+	}
+
+	return i;
+}
+
+#else
+
+static size_t
+ascii_printable_run_blocks(char const * const s, size_t const len)
+{
+#define ONES UINT64_C(0x0101010101010101)
+#define HIGH_BITS UINT64_C(0x8080808080808080)
+	size_t i = 0;
+
+	/*
+	 * Eight bytes at a time: the top bit of each byte of 'bad' is set if
+	 * that byte has its top bit set, or is below ' ', or is 0x7f.
+	 */
+	for (; i + sizeof(uint64_t) <= len; i += sizeof(uint64_t)) {
+		uint64_t v;
+
+		memcpy(&v, &s[i], sizeof v);
+
+		uint64_t const bad = (v
+				      | ((v - ONES * FIRST_PRINTABLE_ASCII) & ~v)
+				      | (v + ONES))
+			& HIGH_BITS;
+
+		if (bad != 0) {
+			/* The caller finds which byte ended the run. */
+			return i;
+		}
+	}
+
+	return i;
+#undef ONES
+#undef HIGH_BITS
+}
+
+#endif
+
+NO_EXPORT
+size_t
+ascii_printable_run(char const * const s, size_t const len)
+{
+	return ascii_printable_run_bytes(s, len, ascii_printable_run_blocks(s, len));
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+#include <stddef.h>
+
+/*
+ * Return the length of the run of printable ASCII chars (' ' to '~') at the
+ * start of 's'. Most lines are entirely made up of these, and they can be
+ * measured and copied in bulk rather than a char at a time.
+ */
+size_t
+ascii_printable_run(char const *s, size_t len);
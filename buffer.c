@@ -1,33 +1,48 @@
 #include "buffer.h"
 #include "export.h"
 
-#include <stdarg.h>
 #include <stddef.h>
-#include <stdio.h>
-#include <stdlib.h>
 #include <string.h>
 
 #define MIN_CAPACITY_INCREASE 256
 
+static __thread uint64_t grow_count;
+
 NO_EXPORT
 bool
 buffer_grow(struct buffer * const ab, size_t const amount)
 {
-	size_t const extra_bytes =
+	size_t extra_bytes =
 		(amount < MIN_CAPACITY_INCREASE) ? MIN_CAPACITY_INCREASE : amount;
+
+	/*
+	 * Grow geometrically so that a buffer that is appended to repeatedly
+	 * is only reallocated a few times.
+	 */
+	if (extra_bytes < ab->capacity) {
+		extra_bytes = ab->capacity;
+	}
 	size_t const new_capacity = ab->capacity + extra_bytes;
 	/* Allow one extra byte for a NUL terminator. */
-	char * const new_buf = realloc(ab->b, new_capacity + 1);
+	char * const new_buf = mem_realloc(ab->alloc, ab->b, new_capacity + 1);
 
 	if (new_buf == NULL) {
 		return false;
 	}
 	ab->b = new_buf;
 	ab->capacity = new_capacity;
+	grow_count++;
 
 	return true;
 }
 
+NO_EXPORT
+uint64_t
+buffer_grow_count(void)
+{
+	return grow_count;
+}
+
 NO_EXPORT
 bool
 buffer_init(struct buffer * const ab, size_t const initial_capacity)
@@ -66,29 +81,36 @@ buffer_append(struct buffer * const ab, char const * const s, size_t const len)
 }
 
 NO_EXPORT
-void buffer_clear(struct buffer * const ab)
+bool
+buffer_append_number(struct buffer * const ab, size_t value)
 {
-	free(ab->b);
-	ab->b = NULL;
-	ab->len = 0;
-	ab->capacity = 0;
+	/* Enough digits for a 64 bit value. */
+	char digits[20];
+	size_t i = sizeof digits;
+
+	do {
+		digits[--i] = '0' + value % 10;
+		value /= 10;
+	} while (value > 0);
+
+	return buffer_append(ab, &digits[i], sizeof digits - i);
 }
 
 NO_EXPORT
-int buffer_snprintf(
-	struct buffer * const ab,
-	char * const buf,
-	size_t const buf_size,
-	char const * const fmt, ...)
+void buffer_reset(struct buffer * const ab)
 {
-	va_list arg_ptr;
-
-	va_start(arg_ptr, fmt);
-	int const res = vsnprintf(buf, buf_size, fmt, arg_ptr);
-	va_end(arg_ptr);
-
-	buffer_append(ab, buf, strlen(buf));
+	ab->len = 0;
+	if (ab->b != NULL) {
+		ab->b[0] = '\0';
+	}
+}
 
-	return res;
+NO_EXPORT
+void buffer_clear(struct buffer * const ab)
+{
+	mem_free(ab->alloc, ab->b);
+	ab->b = NULL;
+	ab->len = 0;
+	ab->capacity = 0;
 }
 
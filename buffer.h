@@ -1,7 +1,10 @@
 #pragma once
 
+#include "alloc.h"
+
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 
 /*
  * Define a simple "append buffer" structure, that is a heap allocated string
@@ -13,9 +16,11 @@ struct buffer {
 	char *b;
 	size_t len;
 	size_t capacity;
+	struct allocator const *alloc; /* Where the memory comes from. */
 };
 
 
+/* Empty the buffer and allocate memory for it. Its allocator is kept. */
 bool
 buffer_init(struct buffer *ab, size_t initial_capacity);
 
@@ -26,12 +31,25 @@ buffer_init(struct buffer *ab, size_t initial_capacity);
 bool
 buffer_append(struct buffer *ab, char const *s, size_t len);
 
-int
-buffer_snprintf(struct buffer *ab, char *buf, size_t buf_size, char const *fmt, ...);
+/*
+ * Append the decimal representation of 'value' to the buffer.
+ * Return true if successful, else false.
+ */
+bool
+buffer_append_number(struct buffer *ab, size_t value);
 
 bool
 buffer_grow(struct buffer *ab, size_t amount);
 
+/* The number of times that the calling thread has reallocated a buffer. */
+uint64_t
+buffer_grow_count(void);
+
+/* Empty the buffer, but keep its memory for reuse. */
+void
+buffer_reset(struct buffer *ab);
+
+/* Empty the buffer and free its memory. */
 void
 buffer_clear(struct buffer *ab);
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "ascii.h"
+
 #include <stddef.h>
 #include <stdint.h>
 
@@ -67,6 +69,23 @@ grapheme_width(
 	return utf8_grapheme_width(s, len, point, pnext);
 }
 
+/*
+ * Return the end of the run of graphemes from 'point' that are each a single
+ * printable ASCII char, and so one column wide.
+ */
+static inline size_t
+grapheme_ascii_run(char const * const s, size_t const len, size_t const point)
+{
+	size_t const end = point + ascii_printable_run(s + point, len - point);
+
+	/* The last char of the run may combine with a non-ASCII one after it. */
+	if (end > point && end < len && (s[end] & 0x80) != 0) {
+		return end - 1;
+	}
+
+	return end;
+}
+
 #else
 
 #include "utils.h"
@@ -168,5 +187,11 @@ grapheme_width(
 	return char_width(s, len, point);
 }
 
+static inline size_t
+grapheme_ascii_run(char const * const s, size_t const len, size_t const point)
+{
+	return point + ascii_printable_run(s + point, len - point);
+}
+
 #endif
 
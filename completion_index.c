@@ -0,0 +1,145 @@
+#include "completion_index.h"
+#include "export.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+static int
+candidate_compare(void const * const a, void const * const b)
+{
+	return strcmp(*(char const * const *)a, *(char const * const *)b);
+}
+
+minirl_completion_index_st *
+minirl_completion_index_new(char const * const * const candidates, size_t const count)
+{
+	minirl_completion_index_st * const index = calloc(1, sizeof *index);
+	size_t strings_size = 0;
+
+	if (index == NULL) {
+		goto error;
+	}
+	index->refs = 1;
+
+	for (size_t i = 0; i < count; i++) {
+		strings_size += strlen(candidates[i]) + 1;
+	}
+	index->strings = malloc(strings_size > 0 ? strings_size : 1);
+	index->candidates = malloc((count > 0 ? count : 1) * sizeof *index->candidates);
+	if (index->strings == NULL || index->candidates == NULL) {
+		goto error;
+	}
+
+	/* The strings are copied into one block, so the caller's can go. */
+	char *next = index->strings;
+
+	for (size_t i = 0; i < count; i++) {
+		size_t const size = strlen(candidates[i]) + 1;
+
+		memcpy(next, candidates[i], size);
+		index->candidates[i] = next;
+		next += size;
+	}
+	qsort(index->candidates, count, sizeof *index->candidates, candidate_compare);
+
+	/* Drop any duplicates. */
+	for (size_t i = 0; i < count; i++) {
+		if (index->count == 0
+		    || strcmp(index->candidates[index->count - 1], index->candidates[i]) != 0) {
+			index->candidates[index->count++] = index->candidates[i];
+		}
+	}
+
+	return index;
+
+error:
+	minirl_completion_index_free(index);
+
+	return NULL;
+}
+
+minirl_completion_index_st *
+minirl_completion_index_ref(minirl_completion_index_st * const index)
+{
+	__atomic_add_fetch(&index->refs, 1, __ATOMIC_RELAXED);
+
+	return index;
+}
+
+void
+minirl_completion_index_free(minirl_completion_index_st * const index)
+{
+	if (index != NULL && __atomic_sub_fetch(&index->refs, 1, __ATOMIC_ACQ_REL) == 0) {
+		free(index->candidates);
+		free(index->strings);
+		free(index);
+	}
+}
+
+/*
+ * Find the first candidate in [lo, hi) whose first 'len' bytes compare
+ * greater than 'prefix', or greater than or equal to it if 'or_equal'.
+ */
+static size_t
+candidate_search(
+	minirl_completion_index_st const * const index,
+	size_t lo,
+	size_t hi,
+	char const * const prefix,
+	size_t const len,
+	bool const or_equal)
+{
+	while (lo < hi) {
+		size_t const mid = lo + (hi - lo) / 2;
+		int const cmp = strncmp(index->candidates[mid], prefix, len);
+
+		if (cmp < 0 || (cmp == 0 && !or_equal)) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return lo;
+}
+
+NO_EXPORT
+void
+completion_index_lookup(
+	minirl_completion_index_st const * const index,
+	char const * const prefix,
+	size_t const len,
+	struct completion_range const * const within,
+	struct completion_range * const found)
+{
+	size_t lo = 0;
+	size_t hi = index->count;
+
+	if (within != NULL) {
+		lo = within->first;
+		hi = within->first + within->count;
+	}
+
+	size_t const first = candidate_search(index, lo, hi, prefix, len, true);
+	size_t const end = candidate_search(index, first, hi, prefix, len, false);
+
+	found->first = first;
+	found->count = end - first;
+	found->common_len = 0;
+	if (found->count == 0) {
+		return;
+	}
+
+	/*
+	 * The candidates are sorted, so what the first and last have in
+	 * common is common to all of them.
+	 */
+	char const * const a = index->candidates[first];
+	char const * const b = index->candidates[end - 1];
+	size_t common = len;
+
+	while (a[common] != '\0' && a[common] == b[common]) {
+		common++;
+	}
+	found->common_len = common;
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "minirl.h"
+
+#include <stddef.h>
+
+/*
+ * A set of completion candidates, kept sorted so that the candidates
+ * starting with a prefix can be found with a binary search rather than by
+ * looking at each of them.
+ */
+struct minirl_completion_index_st {
+	unsigned refs;
+	char *strings;                  /* The candidates, one after another. */
+	char const **candidates;        /* Sorted, without duplicates. */
+	size_t count;
+};
+
+/* The candidates that start with a prefix. */
+struct completion_range {
+	size_t first;
+	size_t count;
+	size_t common_len;      /* Length of the prefix they all share. */
+};
+
+/*
+ * Find the candidates starting with the 'len' bytes of 'prefix'.
+ * If 'within' isn't NULL it is the result for a prefix that 'prefix' starts
+ * with, and only the candidates in it are searched.
+ */
+void
+completion_index_lookup(
+	minirl_completion_index_st const *index,
+	char const *prefix,
+	size_t len,
+	struct completion_range const *within,
+	struct completion_range *found);
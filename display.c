@@ -0,0 +1,242 @@
+#include "display.h"
+#include "char.h"
+#include "export.h"
+
+#include <string.h>
+
+#define MIN_ROWS_CAPACITY 8
+
+NO_EXPORT
+void
+display_init(struct display * const d, struct allocator const * const alloc)
+{
+	memset(d, 0, sizeof *d);
+	d->alloc = alloc;
+	d->text.alloc = alloc;
+}
+
+NO_EXPORT
+void
+display_free(struct display * const d)
+{
+	buffer_clear(&d->text);
+	mem_free(d->alloc, d->rows);
+	display_init(d, d->alloc);
+}
+
+static bool
+display_row_add(
+	struct display * const d,
+	size_t const start,
+	size_t const end,
+	size_t const width)
+{
+	if (d->num_rows == d->rows_capacity) {
+		size_t const new_capacity = (d->rows_capacity == 0)
+			? MIN_ROWS_CAPACITY : d->rows_capacity * 2;
+		struct display_row * const new_rows =
+			mem_realloc(d->alloc, d->rows, new_capacity * sizeof *new_rows);
+
+		if (new_rows == NULL) {
+			return false;
+		}
+		d->rows = new_rows;
+		d->rows_capacity = new_capacity;
+	}
+
+	d->rows[d->num_rows++] = (struct display_row){
+		.start = start,
+		.end = end,
+		.width = width
+	};
+
+	return true;
+}
+
+/* Where splitting the text into rows has got to. */
+struct wrap_state {
+	size_t row_start;
+	size_t col;
+};
+
+/*
+ * Place the grapheme at 'point' in the rows. A grapheme that won't fit on the
+ * current row starts the next one, and a '\n' ends the row it is on without
+ * occupying any columns.
+ */
+static bool
+display_wrap_grapheme(
+	struct display * const d,
+	struct wrap_state * const wrap,
+	size_t const point,
+	size_t const next,
+	size_t const width,
+	bool const newline)
+{
+	if (width > 0) {
+		if (wrap->col + width > d->terminal_width) {
+			if (!display_row_add(d, wrap->row_start, point, wrap->col)) {
+				return false;
+			}
+			wrap->row_start = point;
+			wrap->col = 0;
+		}
+		wrap->col += width;
+	} else if (newline) {
+		if (!display_row_add(d, wrap->row_start, point, wrap->col)) {
+			return false;
+		}
+		wrap->row_start = next;
+		wrap->col = 0;
+	}
+
+	return true;
+}
+
+/* Place the one column graphemes from 'point' to 'end' in the rows. */
+static bool
+display_wrap_run(
+	struct display * const d,
+	struct wrap_state * const wrap,
+	size_t point,
+	size_t const end)
+{
+	while (point < end) {
+		if (wrap->col >= d->terminal_width) {
+			if (!display_wrap_grapheme(d, wrap, point, point + 1, 1, false)) {
+				return false;
+			}
+			point++;
+			continue;
+		}
+
+		/* Fill the rest of the row in one go. */
+		size_t const space = d->terminal_width - wrap->col;
+		size_t const count = (end - point < space) ? end - point : space;
+
+		wrap->col += count;
+		point += count;
+	}
+
+	return true;
+}
+
+/*
+ * Split the text from 'wrap->row_start', which must be the start of a row, up
+ * to 'end' into rows the same way the terminal wraps it.
+ */
+static bool
+display_wrap_text(struct display * const d, struct wrap_state * const wrap, size_t const end)
+{
+	char const * const s = d->text.b;
+
+	for (size_t point = wrap->row_start; point < end;) {
+		size_t const run_end = grapheme_ascii_run(s, end, point);
+
+		if (run_end > point) {
+			if (!display_wrap_run(d, wrap, point, run_end)) {
+				return false;
+			}
+			point = run_end;
+			continue;
+		}
+
+		size_t next;
+		size_t const width = grapheme_width(s, end, point, &next);
+
+		if (!display_wrap_grapheme(d, wrap, point, next, width, s[point] == '\n')) {
+			return false;
+		}
+		point = next;
+	}
+
+	return true;
+}
+
+/* Split the text from 'row_start', which must be the start of a row, into rows. */
+static bool
+display_wrap(struct display * const d, size_t const row_start)
+{
+	struct wrap_state wrap = { .row_start = row_start };
+
+	return display_wrap_text(d, &wrap, d->text.len)
+		&& display_row_add(d, wrap.row_start, d->text.len, wrap.col);
+}
+
+NO_EXPORT
+bool
+display_build(
+	struct display * const d,
+	char const * const prompt,
+	size_t const prompt_len,
+	char const * const line,
+	size_t const line_len,
+	struct layout_entry const * const graphemes,
+	size_t const grapheme_count,
+	size_t const terminal_width)
+{
+	d->text.len = 0;
+	d->num_rows = 0;
+	d->prompt_len = prompt_len;
+	d->terminal_width = terminal_width;
+
+	if (!buffer_append(&d->text, prompt, prompt_len)
+	    || !buffer_append(&d->text, line, line_len)) {
+		return false;
+	}
+	if (graphemes == NULL) {
+		return display_wrap(d, 0);
+	}
+
+	/* The prompt is measured, then the line is placed using 'graphemes'. */
+	struct wrap_state wrap = { .row_start = 0 };
+
+	if (!display_wrap_text(d, &wrap, prompt_len)) {
+		return false;
+	}
+	for (size_t i = 0; i < grapheme_count; i++) {
+		size_t const point = graphemes[i].point;
+		size_t const run_end = grapheme_ascii_run(line, line_len, point);
+
+		if (run_end > point) {
+			/* Each grapheme in the run is one byte, with one entry. */
+			if (!display_wrap_run(d, &wrap, prompt_len + point, prompt_len + run_end)) {
+				return false;
+			}
+			i += run_end - point - 1;
+			continue;
+		}
+
+		size_t const next = (i + 1 < grapheme_count)
+			? graphemes[i + 1].point : line_len;
+
+		if (!display_wrap_grapheme(d,
+					   &wrap,
+					   prompt_len + point,
+					   prompt_len + next,
+					   graphemes[i].width,
+					   graphemes[i].newline)) {
+			return false;
+		}
+	}
+
+	return display_row_add(d, wrap.row_start, d->text.len, wrap.col);
+}
+
+NO_EXPORT
+bool
+display_append(struct display * const d, char const * const text, size_t const len)
+{
+	if (d->num_rows == 0) {
+		return false;
+	}
+
+	/*
+	 * Only the last row can be affected by the new text, so wrap again
+	 * from its start.
+	 */
+	d->num_rows--;
+
+	return buffer_append(&d->text, text, len)
+		&& display_wrap(d, d->rows[d->num_rows].start);
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "alloc.h"
+#include "buffer.h"
+#include "layout.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/*
+ * A description of the edit line as it appears (or is to appear) on the
+ * terminal: the prompt followed by the visible form of the line, and how
+ * that text is split into rows at the terminal width.
+ * Keeping a copy of what was last written lets a refresh output only the
+ * parts of the line that have changed.
+ */
+struct display_row {
+	size_t start;   /* Offset of the first byte of the row in the text. */
+	size_t end;     /* Offset just past the last byte of the row. */
+	size_t width;   /* Number of columns the row occupies. */
+};
+
+struct display {
+	struct buffer text;
+	size_t prompt_len;
+	size_t terminal_width;
+
+	struct display_row *rows;
+	size_t num_rows;
+	size_t rows_capacity;
+	struct allocator const *alloc;
+};
+
+void
+display_init(struct display *d, struct allocator const *alloc);
+
+void
+display_free(struct display *d);
+
+/*
+ * Set the display text to the prompt followed by the line, and split it into
+ * rows 'terminal_width' columns wide.
+ * If 'graphemes' isn't NULL it holds the 'grapheme_count' layout entries for
+ * the line, whose widths are used rather than measuring the line again.
+ * Return true if successful, else false.
+ */
+bool
+display_build(
+	struct display *d,
+	char const *prompt,
+	size_t prompt_len,
+	char const *line,
+	size_t line_len,
+	struct layout_entry const *graphemes,
+	size_t grapheme_count,
+	size_t terminal_width);
+
+/*
+ * Add text to the end of the display text.
+ * Return true if successful, else false.
+ */
+bool
+display_append(struct display *d, char const *text, size_t len);
+
@@ -0,0 +1,118 @@
+#include "fd_io.h"
+#include "export.h"
+#include "io.h"
+#include "private.h"
+
+#include <errno.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+
+/* Check for input, waiting for some to arrive if 'timeout' is -1. */
+static bool
+input_is_ready(int const fd, int const timeout)
+{
+	struct pollfd pfd = { .fd = fd, .events = POLLIN };
+
+	return TEMP_FAILURE_RETRY(poll(&pfd, 1, timeout)) > 0;
+}
+
+static ssize_t
+fd_io_read(
+	void * const ctx,
+	struct iovec const * const iov,
+	int const iov_count,
+	bool const wait)
+{
+	minirl_st const * const minirl = ctx;
+
+	int const fd = minirl->in.fd;
+
+	if (!wait && !input_is_ready(fd, 0)) {
+		return 0;
+	}
+
+	for (;;) {
+		ssize_t const nread = io_readv(fd, iov, iov_count);
+
+		if (nread >= 0) {
+			/* Only a read of nothing is the end of the input. */
+			return (nread > 0) ? nread : -1;
+		}
+		if (errno != EAGAIN && errno != EWOULDBLOCK) {
+			return -1;
+		}
+		/* A non-blocking fd with no input after all. */
+		if (!wait) {
+			return 0;
+		}
+		if (!input_is_ready(fd, -1)) {
+			return -1;
+		}
+	}
+}
+
+/* Wait until a non-blocking fd can be written to again. */
+static bool
+output_wait(int const fd)
+{
+	struct pollfd pfd = { .fd = fd, .events = POLLOUT };
+
+	return TEMP_FAILURE_RETRY(poll(&pfd, 1, -1)) > 0;
+}
+
+/*
+ * Write all of the buffers, continuing after a short write, and waiting
+ * if the fd is non-blocking and can't take any more yet.
+ */
+static bool
+fd_io_write(void * const ctx, struct iovec const * const iov, int const iov_count)
+{
+	minirl_st const * const minirl = ctx;
+	int const fd = minirl->out.fd;
+	int i = 0;
+	size_t done = 0;        /* The bytes of iov[i] already written. */
+
+	while (i < iov_count) {
+		ssize_t const written = (done == 0)
+			? io_writev(fd, &iov[i], iov_count - i)
+			: io_write(fd, (char const *)iov[i].iov_base + done, iov[i].iov_len - done);
+
+		if (written == -1) {
+			if ((errno == EAGAIN || errno == EWOULDBLOCK) && output_wait(fd)) {
+				continue;
+			}
+			return false;
+		}
+
+		size_t left = written;
+
+		while (i < iov_count && left >= iov[i].iov_len - done) {
+			left -= iov[i].iov_len - done;
+			done = 0;
+			i++;
+		}
+		done += left;
+	}
+
+	return true;
+}
+
+static int
+fd_io_width(void * const ctx)
+{
+	minirl_st const * const minirl = ctx;
+	struct winsize ws;
+
+	if (ioctl(minirl->out.fd, TIOCGWINSZ, &ws) == -1) {
+		return 0;
+	}
+
+	return ws.ws_col;
+}
+
+NO_EXPORT
+minirl_io_st const fd_io = {
+	.read = fd_io_read,
+	.write = fd_io_write,
+	.width = fd_io_width
+};
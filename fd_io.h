@@ -0,0 +1,10 @@
+#pragma once
+
+#include "minirl.h"
+
+/*
+ * The I/O callbacks used by instances created with minirl_new(), which read
+ * and write the file descriptors of the instance's streams. The context is
+ * the instance itself.
+ */
+extern minirl_io_st const fd_io;
@@ -0,0 +1,832 @@
+#include "history.h"
+#include "buffer.h"
+#include "export.h"
+#include "io.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#define HISTORY_BLOCK_SIZE 16384
+
+struct history_block {
+	struct history_block *next;
+	size_t used;
+	size_t capacity;
+	size_t live;            /* The number of entries stored in the block. */
+	char data[];
+};
+
+static void
+history_block_link(struct history * const history, struct history_block * const block)
+{
+	if (history->newest != NULL) {
+		history->newest->next = block;
+	} else {
+		history->oldest = block;
+	}
+	history->newest = block;
+}
+
+static void
+history_block_free(struct history * const history, struct history_block * const block)
+{
+	mem_free(history->alloc, block);
+}
+
+/*
+ * Copy a line to the newest block. If 'unescape' is set the escape sequences
+ * used in history files are replaced by the chars they represent.
+ */
+static bool
+history_store(
+	struct history * const history,
+	struct history_entry * const entry,
+	char const * const line,
+	size_t const len,
+	bool const unescape)
+{
+	struct history_block *block = history->newest;
+
+	if (block == NULL || block->capacity - block->used < len + 1) {
+		size_t const capacity =
+			(len + 1 > HISTORY_BLOCK_SIZE) ? len + 1 : HISTORY_BLOCK_SIZE;
+
+		block = mem_alloc(history->alloc, sizeof *block + capacity);
+		if (block == NULL) {
+			return false;
+		}
+		block->next = NULL;
+		block->used = 0;
+		block->capacity = capacity;
+		block->live = 0;
+		history_block_link(history, block);
+	}
+
+	char * const text = block->data + block->used;
+	size_t stored = len;
+
+	if (unescape) {
+		stored = 0;
+		for (size_t i = 0; i < len; i++) {
+			char ch = line[i];
+
+			if (ch == '\\' && i + 1 < len) {
+				i++;
+				ch = (line[i] == 'n') ? '\n' : line[i];
+			}
+			text[stored++] = ch;
+		}
+	} else {
+		memcpy(text, line, len);
+	}
+	text[stored] = '\0';
+
+	entry->line = text;
+	entry->len = stored;
+	entry->block = block;
+	block->used += stored + 1;
+	block->live++;
+
+	return true;
+}
+
+static void
+history_release(struct history * const history, struct history_entry * const entry)
+{
+	entry->block->live--;
+	entry->block = NULL;
+	entry->line = NULL;
+
+	while (history->oldest != NULL && history->oldest->live == 0) {
+		struct history_block * const block = history->oldest;
+
+		if (block == history->newest) {
+			/* Keep the newest block to store the next lines in. */
+			block->used = 0;
+			break;
+		}
+		history->oldest = block->next;
+		if (block == history->newest) {
+			history->newest = NULL;
+		}
+		history_block_free(history, block);
+	}
+}
+
+static struct history_entry *
+history_entry_at(struct history const * const history, size_t const age)
+{
+	return &history->entries[(history->head + history->count - 1 - age) % history->max_len];
+}
+
+static bool
+history_entries_alloc(struct history * const history)
+{
+	if (history->entries == NULL) {
+		history->entries = mem_calloc(history->alloc, history->max_len, sizeof *history->entries);
+	}
+
+	return history->entries != NULL;
+}
+
+static bool
+history_is_newest(
+	struct history const * const history,
+	char const * const line,
+	size_t const len)
+{
+	if (history->count == 0) {
+		return false;
+	}
+
+	struct history_entry const * const newest = history_entry_at(history, 0);
+
+	return newest->len == len && memcmp(newest->line, line, len) == 0;
+}
+
+/* Remove the oldest entry, and drop it from the index. */
+static void
+history_oldest_remove(struct history * const history)
+{
+	struct history_entry * const oldest = &history->entries[history->head];
+
+	history_index_remove(&history->index, history->added - history->count, oldest->line, oldest->len);
+	history_release(history, oldest);
+	history->head = (history->head + 1) % history->max_len;
+	history->count--;
+}
+
+/*
+ * Make an entry the newest one, and index it. If the history is full the
+ * oldest is removed.
+ */
+static void
+history_push(struct history * const history, struct history_entry const * const entry)
+{
+	struct history_index * const index = &history->index;
+
+	if (history->count == history->max_len) {
+		history_oldest_remove(history);
+	}
+	history->count++;
+	history->added++;
+	*history_entry_at(history, 0) = *entry;
+
+	size_t const seq = history->added - 1;
+
+	if (!history_index_add(index, seq, entry->line, entry->len)) {
+		/*
+		 * Start the index again from the next entry. Searches look at
+		 * every entry until the ones that aren't indexed are removed.
+		 */
+		history_index_reset(index, seq + 1);
+		index->failed = true;
+	} else if (index->failed && history->added - history->count >= index->first_seq) {
+		index->failed = false;
+	}
+}
+
+/*
+ * Append a line to a buffer in the format used in history files. Entries
+ * are written one per line, so newlines in the entry are escaped.
+ */
+static bool
+history_line_format(struct buffer * const ab, char const * const line, size_t const len)
+{
+	size_t start = 0;
+
+	for (size_t i = 0; i < len; i++) {
+		if (line[i] == '\n' || line[i] == '\\') {
+			char const escape[2] = { '\\', (line[i] == '\n') ? 'n' : '\\' };
+
+			if (!buffer_append(ab, line + start, i - start)
+			    || !buffer_append(ab, escape, sizeof escape)) {
+				return false;
+			}
+			start = i + 1;
+		}
+	}
+
+	return buffer_append(ab, line + start, len - start)
+	       && buffer_append(ab, "\n", 1);
+}
+
+static bool
+history_line_write(
+	struct allocator const * const alloc,
+	int const fd,
+	char const * const line,
+	size_t const len)
+{
+	bool success;
+
+	if (memchr(line, '\n', len) == NULL && memchr(line, '\\', len) == NULL) {
+		/* Most lines can be written as they are. */
+		struct iovec iov[2] = {
+			{ .iov_base = (void *)line, .iov_len = len },
+			{ .iov_base = "\n", .iov_len = 1 }
+		};
+
+		success = io_writev(fd, iov, 2) == (ssize_t)(len + 1);
+	} else {
+		struct buffer ab = { .alloc = alloc };
+
+		success = history_line_format(&ab, line, len)
+			  && io_write(fd, ab.b, ab.len) == (ssize_t)ab.len;
+		buffer_clear(&ab);
+	}
+
+	return success;
+}
+
+NO_EXPORT
+void
+history_init(
+	struct history * const history,
+	size_t const max_len,
+	struct allocator const * const alloc)
+{
+	memset(history, 0, sizeof *history);
+	history->max_len = max_len;
+	history->append_fd = -1;
+	history->alloc = alloc;
+	history_index_init(&history->index, alloc);
+}
+
+NO_EXPORT
+void
+history_free(struct history * const history)
+{
+	struct history_block *block = history->oldest;
+
+	while (block != NULL) {
+		struct history_block * const next = block->next;
+
+		history_block_free(history, block);
+		block = next;
+	}
+	mem_free(history->alloc, history->entries);
+	history_append_close(history);
+	history_index_free(&history->index);
+	history_init(history, history->max_len, history->alloc);
+}
+
+NO_EXPORT
+bool
+history_add(struct history * const history, char const * const line, size_t const len)
+{
+	if (history->max_len == 0) {
+		return false;
+	}
+
+	/* Initialization on first call. */
+	if (!history_entries_alloc(history)) {
+		return false;
+	}
+
+	/* Don't add duplicated lines. */
+	if (history_is_newest(history, line, len)) {
+		return false;
+	}
+
+	struct history_entry entry;
+
+	if (!history_store(history, &entry, line, len, false)) {
+		return false;
+	}
+	history_push(history, &entry);
+
+	/* Lines that can't be appended to the file are written by the next save. */
+	if (history->append_fd < 0
+	    || !history_line_write(history->alloc, history->append_fd, line, len)) {
+		if (history->unsaved < history->count) {
+			history->unsaved++;
+		}
+	}
+
+	return true;
+}
+
+NO_EXPORT
+struct history_entry const *
+history_get(struct history const * const history, size_t const age)
+{
+	return history_entry_at(history, age);
+}
+
+NO_EXPORT
+bool
+history_replace(
+	struct history * const history,
+	size_t const age,
+	char const * const line,
+	size_t const len)
+{
+	struct history_entry * const entry = history_entry_at(history, age);
+
+	if (entry->len == len && memcmp(entry->line, line, len) == 0) {
+		return true;
+	}
+
+	struct history_entry replacement;
+
+	if (!history_store(history, &replacement, line, len, false)) {
+		return false;
+	}
+	history_release(history, entry);
+	*entry = replacement;
+
+	size_t const seq = history->added - 1 - age;
+
+	if (seq < history->index.next_seq) {
+		history_index_changed(&history->index, seq);
+	}
+
+	return true;
+}
+
+NO_EXPORT
+bool
+history_set_max_len(struct history * const history, size_t const max_len)
+{
+	if (history->entries == NULL) {
+		history->max_len = max_len;
+		return true;
+	}
+
+	struct history_entry * const entries = mem_calloc(history->alloc, max_len, sizeof *entries);
+
+	if (entries == NULL) {
+		return false;
+	}
+
+	/* If we can't keep everything, release the oldest entries. */
+	while (history->count > max_len) {
+		history_oldest_remove(history);
+	}
+	if (history->unsaved > history->count) {
+		history->unsaved = history->count;
+	}
+	for (size_t i = 0; i < history->count; i++) {
+		entries[i] = history->entries[(history->head + i) % history->max_len];
+	}
+	mem_free(history->alloc, history->entries);
+	history->entries = entries;
+	history->head = 0;
+	history->max_len = max_len;
+
+	return true;
+}
+
+/*
+ * Add the lines of a history file, copied to 'block', to the history.
+ * Lines without escape sequences are used where they are in the block.
+ */
+static void
+history_lines_add(
+	struct history * const history,
+	struct history_block * const block,
+	char * const begin,
+	char * const end)
+{
+	char *p = begin;
+
+	while (p < end) {
+		char * const newline = memchr(p, '\n', end - p);
+		char * const line_end = (newline != NULL) ? newline : end;
+		size_t const len = line_end - p;
+		struct history_entry entry;
+
+		if (len == 0) {
+			/* Skip empty lines. */
+		} else if (memchr(p, '\\', len) != NULL) {
+			if (history_store(history, &entry, p, len, true)) {
+				if (!history_is_newest(history, entry.line, entry.len)) {
+					history_push(history, &entry);
+				} else {
+					history_release(history, &entry);
+				}
+			}
+		} else if (!history_is_newest(history, p, len)) {
+			*line_end = '\0';
+			entry.line = p;
+			entry.len = len;
+			entry.block = block;
+			block->live++;
+			history_push(history, &entry);
+		}
+		p = line_end + 1;
+	}
+}
+
+NO_EXPORT
+bool
+history_load(struct history * const history, char const * const filename)
+{
+	bool success = false;
+	int const fd = open(filename, O_RDONLY | O_CLOEXEC);
+	struct stat st;
+
+	if (fd == -1) {
+		goto done;
+	}
+	if (fstat(fd, &st) == -1) {
+		goto done;
+	}
+	if (history->max_len == 0 || st.st_size == 0) {
+		success = true;
+		goto done;
+	}
+	if (!history_entries_alloc(history)) {
+		goto done;
+	}
+
+	size_t const map_len = st.st_size;
+	char * const map = mmap(NULL, map_len, PROT_READ, MAP_PRIVATE, fd, 0);
+
+	if (map == MAP_FAILED) {
+		goto done;
+	}
+
+	/*
+	 * Only the newest lines fit in the history, so find where they
+	 * start by searching backwards from the end of the file.
+	 */
+	char const * const end = map + map_len;
+	char const *begin = end;
+	char const *line_end = end;
+	size_t found = 0;
+
+	while (line_end > map && found < history->max_len) {
+		char const * const newline = memrchr(map, '\n', line_end - map);
+		char const * const line_start = (newline != NULL) ? newline + 1 : map;
+
+		if (line_start < line_end) {
+			found++;
+			begin = line_start;
+		}
+		line_end = (newline != NULL) ? newline : map;
+	}
+
+	/*
+	 * The lines are copied rather than used from the mapping, which would
+	 * fault if the file was truncated or rewritten while it was in use.
+	 */
+	size_t const tail_len = end - begin;
+	struct history_block * const block = mem_alloc(history->alloc, sizeof *block + tail_len + 1);
+
+	if (block == NULL) {
+		munmap(map, map_len);
+		goto done;
+	}
+	memcpy(block->data, begin, tail_len);
+	block->data[tail_len] = '\0';
+	munmap(map, map_len);
+
+	block->next = NULL;
+	block->used = tail_len + 1;
+	block->capacity = tail_len + 1;
+	/* Hold the block until all of its lines have been added. */
+	block->live = 1;
+	history_block_link(history, block);
+
+	history_lines_add(history, block, block->data, block->data + tail_len);
+
+	/* Loaded entries are already in the file. */
+	history->unsaved = 0;
+
+	if (--block->live == 0) {
+		/* Every line was copied or skipped, so the block isn't needed. */
+		struct history_block **link = &history->oldest;
+		struct history_block *previous = NULL;
+
+		while (*link != block) {
+			previous = *link;
+			link = &previous->next;
+		}
+		*link = block->next;
+		if (history->newest == block) {
+			history->newest = previous;
+		}
+		history_block_free(history, block);
+	}
+	success = true;
+
+done:
+	if (fd != -1) {
+		close(fd);
+	}
+
+	return success;
+}
+
+NO_EXPORT
+bool
+history_save(struct history * const history, char const * const filename)
+{
+	bool success = false;
+	struct buffer ab = { .alloc = history->alloc };
+	int const fd = open(filename, O_WRONLY | O_APPEND | O_CREAT | O_CLOEXEC, 0600);
+
+	if (fd == -1) {
+		goto done;
+	}
+
+	/*
+	 * Only the entries added since the file was loaded or saved need to
+	 * be written, and these are written with a single write() so that
+	 * they aren't interleaved with other writers to the file.
+	 */
+	for (size_t age = history->unsaved; age > 0; age--) {
+		struct history_entry const * const entry = history_entry_at(history, age - 1);
+
+		if (!history_line_format(&ab, entry->line, entry->len)) {
+			goto done;
+		}
+	}
+	if (ab.len > 0 && io_write(fd, ab.b, ab.len) != (ssize_t)ab.len) {
+		goto done;
+	}
+	history->unsaved = 0;
+	success = true;
+
+done:
+	buffer_clear(&ab);
+	if (fd != -1) {
+		close(fd);
+	}
+
+	return success;
+}
+
+NO_EXPORT
+bool
+history_append_open(struct history * const history, char const * const filename)
+{
+	int const fd = open(filename, O_WRONLY | O_APPEND | O_CREAT | O_CLOEXEC, 0600);
+
+	if (fd == -1) {
+		return false;
+	}
+	history_append_close(history);
+	history->append_fd = fd;
+
+	return true;
+}
+
+NO_EXPORT
+void
+history_append_close(struct history * const history)
+{
+	if (history->append_fd >= 0) {
+		close(history->append_fd);
+		history->append_fd = -1;
+	}
+}
+
+/*
+ * Check whether an entry matches a search, setting 'offset' to where the
+ * match starts.
+ */
+typedef bool (*history_match_cb)(
+	struct history_entry const *entry,
+	char const *query,
+	size_t len,
+	size_t *offset);
+
+static bool
+history_contains_match(
+	struct history_entry const * const entry,
+	char const * const query,
+	size_t const len,
+	size_t * const offset)
+{
+	char const * const match = memmem(entry->line, entry->len, query, len);
+
+	if (match == NULL) {
+		return false;
+	}
+	*offset = match - entry->line;
+
+	return true;
+}
+
+static bool
+history_prefix_match(
+	struct history_entry const * const entry,
+	char const * const prefix,
+	size_t const len,
+	size_t * const offset)
+{
+	*offset = 0;
+
+	return entry->len >= len && memcmp(entry->line, prefix, len) == 0;
+}
+
+/*
+ * A search for the entry closest to 'from_age' that matches, going either
+ * towards older or newer entries.
+ */
+struct history_query {
+	history_match_cb match;
+	char const *text;
+	size_t len;
+	size_t from_age;
+	bool newer;
+};
+
+static bool
+history_seq_match(
+	struct history const * const history,
+	struct history_query const * const query,
+	size_t const seq,
+	size_t * const offset)
+{
+	struct history_entry const * const entry =
+		history_entry_at(history, history->added - 1 - seq);
+
+	return query->match(entry, query->text, query->len, offset);
+}
+
+/* Check each entry in turn, for when the index can't help. */
+static bool
+history_query_scan(
+	struct history const * const history,
+	struct history_query const * const query,
+	size_t * const age,
+	size_t * const offset)
+{
+	size_t i = query->from_age;
+
+	while (i < history->count) {
+		if (query->match(history_entry_at(history, i), query->text, query->len, offset)) {
+			*age = i;
+			return true;
+		}
+		if (query->newer) {
+			if (i == 0) {
+				break;
+			}
+			i--;
+		} else {
+			i++;
+		}
+	}
+
+	return false;
+}
+
+/* Check the entries in an index list, along with any changed entries. */
+static bool
+history_query_run(
+	struct history const * const history,
+	struct history_query const * const query,
+	struct history_index_list const * const list,
+	size_t * const age,
+	size_t * const offset)
+{
+	struct history_index const * const index = &history->index;
+	size_t const from_seq = history->added - 1 - query->from_age;
+	size_t const oldest_seq = history->added - history->count;
+	bool found = false;
+	size_t found_seq = 0;
+	size_t found_offset = 0;
+
+	if (list != NULL) {
+		/* Find where the entries newer than 'from_age' start in the list. */
+		size_t lo = list->start;
+		size_t hi = list->count;
+
+		while (lo < hi) {
+			size_t const mid = lo + (hi - lo) / 2;
+			size_t const seq = index->first_seq + list->entries[mid];
+
+			if (seq < from_seq || (seq == from_seq && !query->newer)) {
+				lo = mid + 1;
+			} else {
+				hi = mid;
+			}
+		}
+
+		if (query->newer) {
+			for (size_t i = lo; i < list->count; i++) {
+				size_t const seq = index->first_seq + list->entries[i];
+
+				if (seq >= oldest_seq && history_seq_match(history, query, seq, &found_offset)) {
+					found = true;
+					found_seq = seq;
+					break;
+				}
+			}
+		} else {
+			for (size_t i = lo; i > list->start; i--) {
+				size_t const seq = index->first_seq + list->entries[i - 1];
+
+				if (seq < oldest_seq) {
+					break;
+				}
+				if (history_seq_match(history, query, seq, &found_offset)) {
+					found = true;
+					found_seq = seq;
+					break;
+				}
+			}
+		}
+	}
+
+	/* Entries that were changed after being indexed may also match. */
+	for (size_t i = 0; i < index->changed_count; i++) {
+		size_t const seq = index->changed[i];
+		size_t changed_offset;
+
+		if (seq < oldest_seq
+		    || (query->newer ? seq < from_seq : seq > from_seq)
+		    || (found && (query->newer ? seq > found_seq : seq < found_seq))) {
+			continue;
+		}
+		if (history_seq_match(history, query, seq, &changed_offset)) {
+			found = true;
+			found_seq = seq;
+			found_offset = changed_offset;
+		}
+	}
+
+	if (found) {
+		*age = history->added - 1 - found_seq;
+		*offset = found_offset;
+	}
+
+	return found;
+}
+
+NO_EXPORT
+bool
+history_search(
+	struct history * const history,
+	char const * const query,
+	size_t const len,
+	size_t const from_age,
+	size_t * const age,
+	size_t * const offset)
+{
+	struct history_query const search = {
+		.match = history_contains_match,
+		.text = query,
+		.len = len,
+		.from_age = from_age,
+		.newer = false
+	};
+	struct history_index_list const *list;
+
+	if (from_age >= history->count) {
+		return false;
+	}
+
+	if (len < 3 || history->index.failed) {
+		return history_query_scan(history, &search, age, offset);
+	}
+	if (!history_index_lookup(&history->index, query, len, &list)) {
+		list = NULL;
+	}
+
+	return history_query_run(history, &search, list, age, offset);
+}
+
+NO_EXPORT
+bool
+history_prefix_search(
+	struct history * const history,
+	char const * const prefix,
+	size_t const len,
+	size_t const from_age,
+	bool const newer,
+	size_t * const age)
+{
+	struct history_query const search = {
+		.match = history_prefix_match,
+		.text = prefix,
+		.len = len,
+		.from_age = from_age,
+		.newer = newer
+	};
+	struct history_index_list const *list;
+	size_t offset;
+
+	if (from_age >= history->count) {
+		return false;
+	}
+
+	if (len == 0 || history->index.failed) {
+		return history_query_scan(history, &search, age, &offset);
+	}
+	if (!history_index_prefix_lookup(&history->index, prefix, len, &list)) {
+		list = NULL;
+	}
+
+	return history_query_run(history, &search, list, age, &offset);
+}
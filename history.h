@@ -0,0 +1,128 @@
+#pragma once
+
+#include "alloc.h"
+#include "history_index.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/*
+ * The history lines are stored in a list of blocks. Lines are always added
+ * to the newest block, and as the oldest lines are removed first, blocks are
+ * freed from the oldest end of the list once none of their lines are used.
+ */
+struct history_block;
+
+struct history_entry {
+	char *line;
+	size_t len;
+	struct history_block *block;
+};
+
+/*
+ * A circular buffer of history entries. Adding an entry when the history is
+ * full replaces the oldest one.
+ */
+struct history {
+	size_t max_len;
+	size_t head;            /* Index of the oldest entry. */
+	size_t count;
+	struct history_entry *entries;
+	struct history_block *oldest;
+	struct history_block *newest;
+	size_t unsaved;         /* The number of new entries not yet in a file. */
+	int append_fd;          /* A file that new entries are appended to. */
+	size_t added;           /* The number of entries ever added. */
+	struct history_index index;
+	struct allocator const *alloc;
+};
+
+void
+history_init(struct history *history, size_t max_len, struct allocator const *alloc);
+
+void
+history_free(struct history *history);
+
+/*
+ * Add a line as the newest entry, unless it is the same as the current
+ * newest entry.
+ * Return true if the line was added, else false.
+ */
+bool
+history_add(struct history *history, char const *line, size_t len);
+
+/*
+ * Get an entry, where 'age' 0 is the newest entry. 'age' must be less than
+ * the number of entries.
+ */
+struct history_entry const *
+history_get(struct history const *history, size_t age);
+
+/*
+ * Replace the text of an entry.
+ * Return true if successful, else false.
+ */
+bool
+history_replace(struct history *history, size_t age, char const *line, size_t len);
+
+/*
+ * Change the maximum number of entries, keeping the newest entries if there
+ * are more than will fit.
+ * Return true if successful, else false.
+ */
+bool
+history_set_max_len(struct history *history, size_t max_len);
+
+/*
+ * Add the lines from a history file. Only the newest lines are read if the
+ * file holds more than the maximum number of entries.
+ * Return true if successful, else false.
+ */
+bool
+history_load(struct history *history, char const *filename);
+
+/*
+ * Append the entries added since the history was loaded or saved to a file.
+ * Return true if successful, else false.
+ */
+bool
+history_save(struct history *history, char const *filename);
+
+/*
+ * Write each entry to a file as it is added.
+ * Return true if successful, else false.
+ */
+bool
+history_append_open(struct history *history, char const *filename);
+
+void
+history_append_close(struct history *history);
+
+/*
+ * Find the newest entry containing 'query' that is no newer than
+ * 'from_age'.
+ * Return true if a match is found, setting 'age' to the age of the entry and
+ * 'offset' to where the match starts in it.
+ */
+bool
+history_search(
+	struct history *history,
+	char const *query,
+	size_t len,
+	size_t from_age,
+	size_t *age,
+	size_t *offset);
+
+/*
+ * Find the entry closest to 'from_age' that starts with 'prefix', looking
+ * at 'from_age' and either newer or older entries.
+ * Return true if a match is found, setting 'age' to the age of the entry.
+ */
+bool
+history_prefix_search(
+	struct history *history,
+	char const *prefix,
+	size_t len,
+	size_t from_age,
+	bool newer,
+	size_t *age);
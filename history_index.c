@@ -0,0 +1,388 @@
+#include "history_index.h"
+#include "export.h"
+
+#include <string.h>
+
+#define MIN_TABLE_CAPACITY 1024
+#define MIN_LIST_CAPACITY 4
+/* Longer prefixes share the list of their first PREFIX_MAX_LEN bytes. */
+#define PREFIX_MAX_LEN 12
+#define PREFIX_HASH_INIT UINT32_C(2166136261)
+
+static uint32_t
+trigram_get(char const * const s)
+{
+	return ((uint32_t)(uint8_t)s[0] << 16)
+	       | ((uint32_t)(uint8_t)s[1] << 8)
+	       | (uint32_t)(uint8_t)s[2];
+}
+
+/*
+ * Prefixes are keyed by their FNV-1a hash. Prefixes with the same hash
+ * share a list, which is fine as the entries found are always checked.
+ */
+static uint32_t
+prefix_hash_next(uint32_t const hash, char const c)
+{
+	return (hash ^ (uint8_t)c) * UINT32_C(16777619);
+}
+
+static size_t
+slot_home(struct history_index_table const * const table, uint32_t const key)
+{
+	return (key * UINT32_C(2654435761)) & (table->capacity - 1);
+}
+
+/* Find the list for a key, or the empty slot where it belongs. */
+static struct history_index_list *
+list_find(struct history_index_table const * const table, uint32_t const key)
+{
+	size_t const mask = table->capacity - 1;
+	size_t slot = slot_home(table, key);
+
+	while (table->lists[slot].entries != NULL && table->lists[slot].key != key) {
+		slot = (slot + 1) & mask;
+	}
+
+	return &table->lists[slot];
+}
+
+/* Keep the hash table at most half full. */
+static bool
+table_grow(struct allocator const * const alloc, struct history_index_table * const table)
+{
+	if ((table->count + 1) * 2 <= table->capacity) {
+		return true;
+	}
+
+	struct history_index_table grown = {
+		.count = table->count,
+		.capacity = (table->capacity == 0) ? MIN_TABLE_CAPACITY : table->capacity * 2
+	};
+
+	grown.lists = mem_calloc(alloc, grown.capacity, sizeof *grown.lists);
+	if (grown.lists == NULL) {
+		return false;
+	}
+	for (size_t i = 0; i < table->capacity; i++) {
+		struct history_index_list const * const list = &table->lists[i];
+
+		if (list->entries != NULL) {
+			*list_find(&grown, list->key) = *list;
+		}
+	}
+	mem_free(alloc, table->lists);
+	*table = grown;
+
+	return true;
+}
+
+static void
+table_reset(struct allocator const * const alloc, struct history_index_table * const table)
+{
+	for (size_t i = 0; i < table->capacity; i++) {
+		mem_free(alloc, table->lists[i].entries);
+	}
+	if (table->lists != NULL) {
+		memset(table->lists, 0, table->capacity * sizeof *table->lists);
+	}
+	table->count = 0;
+}
+
+/*
+ * Free a list that has become empty. The lists after it that were placed
+ * further from where they belong are moved back to fill the gap, so that
+ * none of them is cut off from its slot.
+ */
+static void
+table_remove(
+	struct allocator const * const alloc,
+	struct history_index_table * const table,
+	struct history_index_list * const list)
+{
+	size_t const mask = table->capacity - 1;
+	size_t gap = list - table->lists;
+	size_t slot = gap;
+
+	mem_free(alloc, list->entries);
+	for (;;) {
+		slot = (slot + 1) & mask;
+
+		struct history_index_list * const next = &table->lists[slot];
+
+		if (next->entries == NULL) {
+			break;
+		}
+		if (((slot - slot_home(table, next->key)) & mask) >= ((slot - gap) & mask)) {
+			table->lists[gap] = *next;
+			gap = slot;
+		}
+	}
+	memset(&table->lists[gap], 0, sizeof table->lists[gap]);
+	table->count--;
+}
+
+static bool
+list_append(
+	struct allocator const * const alloc,
+	struct history_index_list * const list,
+	uint32_t const entry)
+{
+	if (list->count == list->capacity && list->start > 0 && list->start >= list->capacity / 2) {
+		/* Reuse the space of the dropped entries. */
+		list->count -= list->start;
+		memmove(list->entries, list->entries + list->start, list->count * sizeof *list->entries);
+		list->start = 0;
+	}
+	if (list->count == list->capacity) {
+		uint32_t const capacity = (list->capacity == 0)
+					  ? MIN_LIST_CAPACITY
+					  : list->capacity * 2;
+		uint32_t * const entries = mem_realloc(alloc, list->entries, capacity * sizeof *entries);
+
+		if (entries == NULL) {
+			return false;
+		}
+		list->entries = entries;
+		list->capacity = capacity;
+	}
+	list->entries[list->count++] = entry;
+
+	return true;
+}
+
+/* Add an entry to the list for 'key', unless it is already listed. */
+static bool
+table_add(
+	struct allocator const * const alloc,
+	struct history_index_table * const table,
+	uint32_t const key,
+	uint32_t const entry)
+{
+	if (!table_grow(alloc, table)) {
+		return false;
+	}
+
+	struct history_index_list * const list = list_find(table, key);
+
+	if (list->entries == NULL) {
+		list->key = key;
+		if (!list_append(alloc, list, entry)) {
+			return false;
+		}
+		table->count++;
+	} else if (list->entries[list->count - 1] != entry) {
+		if (!list_append(alloc, list, entry)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/* Drop the entries up to and including 'last' from the list for 'key'. */
+static void
+table_drop(
+	struct allocator const * const alloc,
+	struct history_index_table * const table,
+	uint32_t const key,
+	uint32_t const last)
+{
+	if (table->capacity == 0) {
+		return;
+	}
+
+	struct history_index_list * const list = list_find(table, key);
+
+	if (list->entries == NULL) {
+		return;
+	}
+	while (list->start < list->count && list->entries[list->start] <= last) {
+		list->start++;
+	}
+	if (list->start == list->count) {
+		table_remove(alloc, table, list);
+	}
+}
+
+static struct history_index_list const *
+table_lookup(struct history_index_table const * const table, uint32_t const key)
+{
+	if (table->capacity == 0) {
+		return NULL;
+	}
+
+	struct history_index_list const * const list = list_find(table, key);
+
+	return (list->entries != NULL) ? list : NULL;
+}
+
+NO_EXPORT
+void
+history_index_init(struct history_index * const index, struct allocator const * const alloc)
+{
+	memset(index, 0, sizeof *index);
+	index->alloc = alloc;
+}
+
+NO_EXPORT
+void
+history_index_free(struct history_index * const index)
+{
+	history_index_reset(index, 0);
+	mem_free(index->alloc, index->trigrams.lists);
+	mem_free(index->alloc, index->prefixes.lists);
+	mem_free(index->alloc, index->changed);
+	history_index_init(index, index->alloc);
+}
+
+NO_EXPORT
+void
+history_index_reset(struct history_index * const index, size_t const first_seq)
+{
+	table_reset(index->alloc, &index->trigrams);
+	table_reset(index->alloc, &index->prefixes);
+	index->first_seq = first_seq;
+	index->next_seq = first_seq;
+	index->changed_count = 0;
+	index->failed = false;
+}
+
+NO_EXPORT
+bool
+history_index_add(
+	struct history_index * const index,
+	size_t const seq,
+	char const * const line,
+	size_t const len)
+{
+	uint32_t const entry = seq - index->first_seq;
+	uint32_t hash = PREFIX_HASH_INIT;
+
+	if (seq - index->first_seq > UINT32_MAX) {
+		goto fail;
+	}
+	for (size_t i = 0; i + 3 <= len; i++) {
+		if (!table_add(index->alloc, &index->trigrams, trigram_get(line + i), entry)) {
+			goto fail;
+		}
+	}
+	for (size_t i = 0; i < len && i < PREFIX_MAX_LEN; i++) {
+		hash = prefix_hash_next(hash, line[i]);
+		if (!table_add(index->alloc, &index->prefixes, hash, entry)) {
+			goto fail;
+		}
+	}
+	index->next_seq = seq + 1;
+
+	return true;
+
+fail:
+	index->failed = true;
+
+	return false;
+}
+
+NO_EXPORT
+void
+history_index_remove(
+	struct history_index * const index,
+	size_t const seq,
+	char const * const line,
+	size_t const len)
+{
+	if (seq < index->first_seq || seq >= index->next_seq) {
+		/* The entry was never indexed. */
+		return;
+	}
+
+	uint32_t const last = seq - index->first_seq;
+	uint32_t hash = PREFIX_HASH_INIT;
+
+	for (size_t i = 0; i + 3 <= len; i++) {
+		table_drop(index->alloc, &index->trigrams, trigram_get(line + i), last);
+	}
+	for (size_t i = 0; i < len && i < PREFIX_MAX_LEN; i++) {
+		hash = prefix_hash_next(hash, line[i]);
+		table_drop(index->alloc, &index->prefixes, hash, last);
+	}
+
+	size_t kept = 0;
+
+	for (size_t i = 0; i < index->changed_count; i++) {
+		if (index->changed[i] > seq) {
+			index->changed[kept++] = index->changed[i];
+		}
+	}
+	index->changed_count = kept;
+}
+
+NO_EXPORT
+bool
+history_index_changed(struct history_index * const index, size_t const seq)
+{
+	for (size_t i = 0; i < index->changed_count; i++) {
+		if (index->changed[i] == seq) {
+			return true;
+		}
+	}
+	if (index->changed_count == index->changed_capacity) {
+		size_t const capacity = (index->changed_capacity == 0)
+					? MIN_LIST_CAPACITY
+					: index->changed_capacity * 2;
+		size_t * const changed = mem_realloc(index->alloc, index->changed, capacity * sizeof *changed);
+
+		if (changed == NULL) {
+			index->failed = true;
+			return false;
+		}
+		index->changed = changed;
+		index->changed_capacity = capacity;
+	}
+	index->changed[index->changed_count++] = seq;
+
+	return true;
+}
+
+NO_EXPORT
+bool
+history_index_lookup(
+	struct history_index const * const index,
+	char const * const query,
+	size_t const len,
+	struct history_index_list const ** const list)
+{
+	*list = NULL;
+	for (size_t i = 0; i + 3 <= len; i++) {
+		struct history_index_list const * const candidate =
+			table_lookup(&index->trigrams, trigram_get(query + i));
+
+		if (candidate == NULL) {
+			return false;
+		}
+		if (*list == NULL
+		    || candidate->count - candidate->start < (*list)->count - (*list)->start) {
+			*list = candidate;
+		}
+	}
+
+	return *list != NULL;
+}
+
+NO_EXPORT
+bool
+history_index_prefix_lookup(
+	struct history_index const * const index,
+	char const * const prefix,
+	size_t const len,
+	struct history_index_list const ** const list)
+{
+	uint32_t hash = PREFIX_HASH_INIT;
+
+	for (size_t i = 0; i < len && i < PREFIX_MAX_LEN; i++) {
+		hash = prefix_hash_next(hash, prefix[i]);
+	}
+	*list = table_lookup(&index->prefixes, hash);
+
+	return *list != NULL;
+}
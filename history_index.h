@@ -0,0 +1,109 @@
+#pragma once
+
+#include "alloc.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Indexes of the history entries, used to find the entries that may match a
+ * search without looking at every entry.
+ * Entries are identified by a sequence number that increases by one with
+ * each entry added to the history, so the entries in each list are always in
+ * the order they were added. Entries are indexed as they are added, and are
+ * dropped from the start of the lists as they are removed from the history.
+ */
+struct history_index_list {
+	uint32_t key;
+	uint32_t start;         /* The first entry still in the history. */
+	uint32_t count;
+	uint32_t capacity;
+	uint32_t *entries;      /* Sequence numbers relative to 'first_seq'. */
+};
+
+/* A hash table of lists of entries. */
+struct history_index_table {
+	struct history_index_list *lists;
+	size_t count;
+	size_t capacity;
+};
+
+struct history_index {
+	/* The entries containing each trigram (sequence of three bytes). */
+	struct history_index_table trigrams;
+	/* The entries starting with each prefix, up to a maximum length. */
+	struct history_index_table prefixes;
+	size_t first_seq;       /* The oldest entry that may be indexed. */
+	size_t next_seq;        /* The next entry to be indexed. */
+	/* Indexed entries that have been changed since, so must be searched. */
+	size_t *changed;
+	size_t changed_count;
+	size_t changed_capacity;
+	/*
+	 * Set while the history holds entries from before 'first_seq', as
+	 * an entry couldn't be indexed, so every entry must be searched.
+	 */
+	bool failed;
+	struct allocator const *alloc;
+};
+
+void
+history_index_init(struct history_index *index, struct allocator const *alloc);
+
+void
+history_index_free(struct history_index *index);
+
+/* Empty the index. Entries from 'first_seq' onwards may be indexed. */
+void
+history_index_reset(struct history_index *index, size_t first_seq);
+
+/*
+ * Index an entry. Entries must be added in sequence.
+ * Return true if successful, else false, in which case the index can't be
+ * used until it is reset.
+ */
+bool
+history_index_add(struct history_index *index, size_t seq, char const *line, size_t len);
+
+/*
+ * Drop an entry that has been removed from the history, which must be the
+ * oldest one indexed, given the line it has now. Any older entries still
+ * listed under the keys of the line, as they were changed after being
+ * indexed, are dropped too.
+ */
+void
+history_index_remove(struct history_index *index, size_t seq, char const *line, size_t len);
+
+/*
+ * Record that an indexed entry has changed.
+ * Return true if successful, else false.
+ */
+bool
+history_index_changed(struct history_index *index, size_t seq);
+
+/*
+ * Get the entries that may contain 'query', which must be at least three
+ * bytes long. The list of the least common trigram in the query is given,
+ * and must be checked along with the changed entries.
+ * Return false if there is a trigram in 'query' that no entry contains.
+ */
+bool
+history_index_lookup(
+	struct history_index const *index,
+	char const *query,
+	size_t len,
+	struct history_index_list const **list);
+
+/*
+ * Get the entries that may start with 'prefix'. The list must be checked
+ * along with the changed entries, as only the start of long prefixes is
+ * indexed.
+ * Return false if no entry starts with 'prefix'.
+ */
+bool
+history_index_prefix_lookup(
+	struct history_index const *index,
+	char const *prefix,
+	size_t len,
+	struct history_index_list const **list);
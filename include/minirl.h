@@ -9,12 +9,64 @@ extern "C"
 #include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <sys/types.h>
+#include <sys/uio.h>
 
 typedef struct minirl_st minirl_st;
+typedef struct minirl_config_st minirl_config_st;
+typedef struct minirl_completion_index_st minirl_completion_index_st;
 
 typedef bool (*minirl_key_binding_handler_cb)(
 	minirl_st *minirl, char const *key, void *user_ctx);
 
+/*
+ * The callbacks an instance uses for its input and output, so that it can be
+ * used with something other than a pair of file descriptors, e.g. a network
+ * connection. 'ctx' is the context given when the instance was created.
+ */
+typedef struct minirl_io_st {
+	/*
+	 * Read into the buffers in 'iov'. If 'wait' is false and no input is
+	 * available return 0, else wait for some to arrive.
+	 * Return the number of bytes read, or -1 on EOF or error.
+	 * May be NULL if input is only passed in using minirl_feed().
+	 */
+	ssize_t (*read)(void *ctx, struct iovec const *iov, int iov_count, bool wait);
+	/*
+	 * Write all of the buffers in 'iov', waiting if need be until they
+	 * can be. A partial write must not be reported as success. Return
+	 * false on error, in which case the output is dropped rather than
+	 * given again, as some of it may have been written already.
+	 */
+	bool (*write)(void *ctx, struct iovec const *iov, int iov_count);
+	/*
+	 * Optional. Called once the output for an update has been written,
+	 * before waiting for more input or returning to the caller.
+	 */
+	void (*flush)(void *ctx);
+	/* Optional. Return the terminal width in columns, or 0 if unknown. */
+	int (*width)(void *ctx);
+} minirl_io_st;
+
+/*
+ * The callbacks an instance allocates its memory with, in place of malloc(),
+ * realloc() and free(). 'ctx' is the context given when the instance was
+ * created. They are only called by the thread using the instance, never by
+ * minirl_async_print() or the delivery of completions.
+ * Key bindings, configs, completion indexes and the lines returned by
+ * minirl_readline() may outlive the instance, so still use malloc().
+ */
+typedef struct minirl_allocator_st {
+	void *(*malloc)(void *ctx, size_t size);
+	/* Resize memory got from these callbacks. 'ptr' is never NULL. */
+	void *(*realloc)(void *ctx, void *ptr, size_t size);
+	/*
+	 * Optional. If NULL nothing is freed by the instance, which suits a
+	 * pool that is released all at once after minirl_delete().
+	 */
+	void (*free)(void *ctx, void *ptr);
+} minirl_allocator_st;
+
 
 /*
  * Get the current pointer to the line buffer.
@@ -56,6 +108,16 @@ minirl_text_insert(minirl_st *minirl, char const *text);
 int
 minirl_terminal_width(minirl_st *minirl);
 
+/*
+ * Track changes to the terminal size by handling SIGWINCH, rather than
+ * querying the terminal width each time the edit line is refreshed.
+ * A resize while a line is being edited causes it to be redrawn straight
+ * away. Any SIGWINCH handler installed by the application is still called.
+ * Return false if the signal handler couldn't be installed.
+ */
+bool
+minirl_resize_tracking_enable(minirl_st *minirl);
+
 /*
  * Given a list of possible completions, attempt to complete the current word
  * as much as possible.
@@ -68,6 +130,82 @@ bool minirl_complete(
 	char const * const *matches,
 	bool allow_prefix);
 
+/*
+ * Create an index of completion candidates, for sets of candidates that are
+ * too big to pass to minirl_complete() on each completion. The strings are
+ * copied, and duplicates are dropped. The index can't be changed once
+ * created, and may be shared by instances used from several threads.
+ * Returns NULL if out of memory.
+ */
+minirl_completion_index_st *
+minirl_completion_index_new(char const * const *candidates, size_t count);
+
+/* Add a reference to a completion index. */
+minirl_completion_index_st *
+minirl_completion_index_ref(minirl_completion_index_st *index);
+
+/* Drop a reference to a completion index, freeing it once there are none left. */
+void
+minirl_completion_index_free(minirl_completion_index_st *index);
+
+/*
+ * Complete the word from 'start' to the current editing position using the
+ * candidates in 'index' that start with it, in the same way as
+ * minirl_complete().
+ * Completing again with a longer word, as happens with repeated requests,
+ * only searches the candidates found by the previous completion.
+ */
+bool
+minirl_complete_from_index(
+	minirl_st *minirl,
+	unsigned start,
+	minirl_completion_index_st *index,
+	bool allow_prefix);
+
+/*
+ * Start completing the word from 'start' to the current editing position
+ * without waiting for the matches, e.g. for a key handler whose matches come
+ * from a remote service. Editing carries on in the meantime. Any earlier
+ * request is cancelled.
+ * Returns a token identifying the request, to be passed to
+ * minirl_complete_deliver() along with the matches, or 0 if out of memory.
+ */
+unsigned long
+minirl_complete_async(minirl_st *minirl, unsigned start);
+
+/*
+ * Deliver the matches for a request started by minirl_complete_async(),
+ * which are then used to complete the word as minirl_complete() would.
+ * The matches are copied, and may be delivered from any thread.
+ * They are dropped if the request has been cancelled, which happens once a
+ * later key changes the line or moves the cursor, or the line is finished.
+ * Returns false if out of memory.
+ */
+bool
+minirl_complete_deliver(
+	minirl_st *minirl,
+	unsigned long token,
+	char const * const *matches,
+	bool allow_prefix);
+
+/*
+ * Whether the matches for a request are still wanted, so that a lookup that
+ * has been cancelled can be abandoned. May be called from any thread.
+ */
+bool
+minirl_complete_is_pending(minirl_st *minirl, unsigned long token);
+
+/*
+ * A file descriptor that becomes readable when matches are delivered, or
+ * messages are printed with minirl_async_print().
+ * minirl_readline() waits on it along with its input stream, but an event
+ * loop using minirl_readline_start() must poll it too, and call
+ * minirl_on_wakeup() when it is readable.
+ * Returns -1 on error.
+ */
+int
+minirl_wakeup_fd(minirl_st *minirl);
+
 /* Bind a key handler to a key. */
 bool
 minirl_bind_key(
@@ -87,6 +225,15 @@ minirl_bind_key_sequence(
 	minirl_key_binding_handler_cb handler,
 	void *context);
 
+/*
+ * Use the key bindings of 'from', for example to give many instances the
+ * same bindings without each holding a copy of them. The bindings are
+ * shared until either instance binds a key, at which point it gets its own
+ * copy.
+ */
+void
+minirl_keymap_share(minirl_st *minirl, minirl_st *from);
+
 /*
  * The main 'readline' function.
  * 'prompt' is displayed at the start of the line.
@@ -94,10 +241,85 @@ minirl_bind_key_sequence(
 char *
 minirl_readline(minirl_st *minirl, char const *prompt);
 
+/*
+ * Like minirl_readline(), but rather than a copy of the line that must be
+ * freed, the line is returned in place in a buffer belonging to 'minirl'.
+ * If 'len' isn't NULL it is set to the length of the line.
+ * The line remains valid until the next line is read or started.
+ */
+char const *
+minirl_readline_view(minirl_st *minirl, char const *prompt, size_t *len);
+
+/*
+ * Like minirl_readline(), but the line is read into the caller's buffer in the
+ * same way as getline(). '*line' is a buffer of '*size' bytes allocated with
+ * malloc(), or NULL. The buffer is reallocated if it is too small, updating
+ * '*line' and '*size', so the same buffer can be passed in for each line.
+ * Returns the length of the line, or -1 on EOF or error. The buffer must be
+ * freed by the caller, even if -1 is returned.
+ */
+ssize_t
+minirl_readline_into(minirl_st *minirl, char const *prompt, char **line, size_t *size);
+
 /* Free a line returned by minirl_readline. */
 void
 minirl_line_free(void *ptr);
 
+enum minirl_status {
+	MINIRL_STATUS_PENDING,  /* More input is needed to complete the line. */
+	MINIRL_STATUS_LINE,     /* The line is complete. */
+	MINIRL_STATUS_EOF,      /* The input has ended. */
+	/*
+	 * A key handler indicated an error (e.g. CTRL-D on an empty line), or
+	 * an error occurred. minirl_readline() would return NULL.
+	 */
+	MINIRL_STATUS_ERROR
+};
+
+/*
+ * Start reading a line without blocking, for use with an event loop that
+ * drives many instances. 'prompt' is displayed at the start of the line.
+ * The input is then passed in using minirl_feed() or minirl_on_readable(),
+ * and once they return MINIRL_STATUS_LINE the line can be got using
+ * minirl_line_get(). It remains valid until the next line is started.
+ * Any line already being read is abandoned.
+ * Returns true if successful, else false.
+ */
+bool
+minirl_readline_start(minirl_st *minirl, char const *prompt);
+
+/*
+ * Process input for the line being read. Processing stops once the line is
+ * complete, and the rest of 'bytes' is kept for the next line. It is
+ * processed by the next call to minirl_feed() or minirl_on_readable() after
+ * the next line is started, which may be given no bytes.
+ * With resize tracking enabled, calling this with no bytes after a SIGWINCH
+ * redraws the line for the new terminal width.
+ */
+enum minirl_status
+minirl_feed(minirl_st *minirl, char const *bytes, size_t len);
+
+/*
+ * Process the input available from the input stream of 'minirl', e.g. when
+ * an event loop finds that it is readable.
+ */
+enum minirl_status
+minirl_on_readable(minirl_st *minirl);
+
+/*
+ * Process any matches delivered, or messages printed, since the wakeup fd was
+ * last readable.
+ */
+enum minirl_status
+minirl_on_wakeup(minirl_st *minirl);
+
+/*
+ * Abandon the line being read, if any, and restore the terminal settings.
+ * Not needed once the line is complete.
+ */
+void
+minirl_readline_stop(minirl_st *minirl);
+
 /* Add a line to the history. Access the history using the up/down arrows. */
 int
 minirl_history_add(minirl_st *minirl, char const *line);
@@ -110,6 +332,34 @@ minirl_history_add(minirl_st *minirl, char const *line);
 int
 minirl_history_set_max_len(minirl_st *minirl, size_t len);
 
+/*
+ * Load the history from a file, one entry per line. If the file holds more
+ * entries than the maximum history length only the newest are loaded.
+ * Returns true if successful, else false.
+ */
+bool
+minirl_history_load(minirl_st *minirl, char const *filename);
+
+/*
+ * Append the entries added since the history was loaded or last saved to a
+ * file. The rest of the file is left as it is.
+ * Returns true if successful, else false.
+ */
+bool
+minirl_history_save(minirl_st *minirl, char const *filename);
+
+/*
+ * Append each entry to a file as soon as it is added to the history, so the
+ * file is kept up to date without needing to be saved.
+ * Returns true if successful, else false.
+ */
+bool
+minirl_history_append_enable(minirl_st *minirl, char const *filename);
+
+/* Stop appending entries to the history file. */
+void
+minirl_history_append_disable(minirl_st *minirl);
+
 /* Clear the screen. */
 void
 minirl_screen_clear(minirl_st *minirl);
@@ -130,10 +380,58 @@ minirl_force_isatty(minirl_st *minirl);
 struct minirl_st *
 minirl_new(FILE *in_stream, FILE *out_stream);
 
+/*
+ * Create a new minirl instance with the key bindings and options in
+ * 'config'. The bindings are shared with the config rather than copied, so
+ * creating many instances from one config is cheap. Changes made to the
+ * instance afterwards don't affect the config or other instances.
+ */
+struct minirl_st *
+minirl_new_with_config(FILE *in_stream, FILE *out_stream, minirl_config_st *config);
+
+/*
+ * Create a new minirl instance that uses the callbacks in 'io' for its input
+ * and output, rather than a pair of streams. 'io' must remain valid for the
+ * life of the instance. The input is treated as coming from a terminal.
+ * If 'config' is NULL the default key bindings and options are used.
+ */
+struct minirl_st *
+minirl_new_with_io(minirl_io_st const *io, void *ctx, minirl_config_st *config);
+
+/*
+ * As minirl_new_with_io(), but with the instance's memory allocated using
+ * the callbacks in 'allocator', which must remain valid for the life of the
+ * instance.
+ */
+struct minirl_st *
+minirl_new_with_allocator(
+	minirl_io_st const *io,
+	void *io_ctx,
+	minirl_config_st *config,
+	minirl_allocator_st const *allocator,
+	void *allocator_ctx);
+
 /* Free a minirl instance created using minirl_new(). */
 void
 minirl_delete(minirl_st *minirl);
 
+/*
+ * Take a snapshot of the key bindings and options of 'minirl', to create
+ * other instances with using minirl_new_with_config(). The config can't be
+ * changed once taken, and may be used from several threads.
+ * Returns NULL if out of memory.
+ */
+minirl_config_st *
+minirl_config_new(minirl_st *minirl);
+
+/* Add a reference to a config. */
+minirl_config_st *
+minirl_config_ref(minirl_config_st *config);
+
+/* Drop a reference to a config, freeing it once there are none left. */
+void
+minirl_config_free(minirl_config_st *config);
+
 /*
  * Print text to the terminal. Should normally require a call to
  * minirl_line_state_reset() so that the edit line is printed afresh.
@@ -141,6 +439,21 @@ minirl_delete(minirl_st *minirl);
 int
 minirl_printf(minirl_st *minirl, char const * fmt, ...);
 
+/*
+ * Print text above the line being edited. Unlike minirl_printf(), this may
+ * be called from any thread, e.g. to show log messages while the user types.
+ * The text is queued, and written by the thread editing the line once it is
+ * waiting for input, along with any other messages queued in the meantime,
+ * after which the edit line is redrawn. A newline is added if the messages
+ * don't end with one. minirl_readline() waits for messages itself, while an
+ * event loop using minirl_readline_start() must poll minirl_wakeup_fd().
+ * Messages printed while no line is being read are written above the next
+ * prompt.
+ * Returns the number of bytes queued, or -1 on error.
+ */
+int
+minirl_async_print(minirl_st *minirl, char const *fmt, ...);
+
 /*
  * Called by a key handler callback to indicate that line editing has completed.
  */
@@ -191,6 +504,131 @@ minirl_echo_enable(minirl_st *minirl);
 void
 minirl_echo_disable(minirl_st *minirl, char echo_char);
 
+/*
+ * Enable bracketed paste mode. The terminal is asked to mark the start and
+ * end of pasted text, and everything pasted is inserted into the line
+ * literally rather than having any newlines or key bindings acted upon.
+ * This is disabled by default.
+ */
+void
+minirl_bracketed_paste_enable(minirl_st *minirl);
+
+/* Disable bracketed paste mode. */
+void
+minirl_bracketed_paste_disable(minirl_st *minirl);
+
+/*
+ * Set the maximum time in milliseconds that refreshing the edit line may be
+ * deferred while more input is waiting to be processed.
+ * Setting 0 refreshes the line after every key.
+ * Defaults to 40.
+ */
+void
+minirl_refresh_budget_set(minirl_st *minirl, unsigned milliseconds);
+
+/*
+ * Set the number of completions above which the user is asked whether to
+ * display them all, rather than them just being displayed.
+ * Setting 0 always displays them.
+ * Defaults to 100.
+ */
+void
+minirl_completion_query_items_set(minirl_st *minirl, size_t items);
+
+#define MINIRL_STATS_LATENCY_BUCKETS 16
+
+/* Counts of what an instance has done, to see what editing costs. */
+typedef struct minirl_stats_st {
+	uint64_t reads;             /* Calls made to read input. */
+	uint64_t writes;            /* Calls made to write output. */
+	uint64_t bytes_written;
+	uint64_t full_refreshes;    /* Refreshes of the whole line. */
+	uint64_t cursor_refreshes;  /* Refreshes that only moved the cursor. */
+	uint64_t buffer_grows;      /* Buffers reallocated while handling keys. */
+	uint64_t history_adds;
+	uint64_t history_moves;     /* Moves to the previous or next entry. */
+	uint64_t history_searches;  /* Searches of the history for a query. */
+	uint64_t keys;              /* Keys passed to their handlers. */
+	/*
+	 * The number of keys that took from 2^i up to 2^(i+1) microseconds to
+	 * handle, including refreshing the line. The first bucket counts all
+	 * keys under 2 microseconds, and the last all the slower ones.
+	 */
+	uint64_t key_latency[MINIRL_STATS_LATENCY_BUCKETS];
+} minirl_stats_st;
+
+/*
+ * Start counting what the instance does, from zero. Counting is off by
+ * default, as timing each key has a cost.
+ */
+void
+minirl_stats_enable(minirl_st *minirl);
+
+void
+minirl_stats_disable(minirl_st *minirl);
+
+/* Set the counts back to zero. */
+void
+minirl_stats_reset(minirl_st *minirl);
+
+/* Get the counts so far. Returns false if counting isn't enabled. */
+bool
+minirl_stats_get(minirl_st const *minirl, minirl_stats_st *stats);
+
+/*
+ * Called after each key has been handled, with the key, the handler bound
+ * to it, and the time taken in nanoseconds, including refreshing the line.
+ */
+typedef void (*minirl_trace_key_cb)(
+	minirl_st *minirl,
+	char const *key,
+	minirl_key_binding_handler_cb handler,
+	uint64_t elapsed_ns,
+	void *user_ctx);
+
+/*
+ * Set a callback to trace the handling of each key, or NULL for none.
+ * Tracing is only built in with the WITH_TRACE build option, and without it
+ * this returns false.
+ */
+bool
+minirl_trace_key_set(minirl_st *minirl, minirl_trace_key_cb cb, void *user_ctx);
+
+/*
+ * Record the input read by the instance, and the terminal widths it sees,
+ * to a file, replacing any existing one, so that the session can be played
+ * back with minirl_replay_new(). Input read without a terminal isn't
+ * recorded.
+ * The file starts with the line "minirl recording 1", followed by events.
+ * Each event is a type byte, 'i' for input or 'w' for a width, the time in
+ * microseconds since recording started as 8 bytes, and a 4 byte value, both
+ * little endian. The value is the number of input bytes that follow, or the
+ * width in columns.
+ * Return true if successful, else false.
+ */
+bool
+minirl_record_start(minirl_st *minirl, char const *filename);
+
+/*
+ * Stop recording and close the file.
+ * Return true if everything was recorded, else false.
+ */
+bool
+minirl_record_stop(minirl_st *minirl);
+
+/*
+ * Create an instance that reads its input from a recording, rather than a
+ * terminal, so that the editing of a session can be repeated and profiled.
+ * The terminal width follows the widths recorded and the output is
+ * discarded; minirl_stats_get() gives what was written. If 'paced' is true
+ * the input is read at the times it was recorded, else as fast as possible.
+ * minirl_readline() returns NULL once the recording ends.
+ * If 'config' is NULL the default key bindings and options are used.
+ * Returns NULL if the recording can't be read.
+ */
+struct minirl_st *
+minirl_replay_new(char const *filename, bool paced, minirl_config_st *config);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,114 @@
+#include "input_buffer.h"
+#include "export.h"
+
+#include <sys/uio.h>
+
+#define INPUT_BUFFER_MASK (INPUT_BUFFER_SIZE - 1)
+
+NO_EXPORT
+void
+input_buffer_init(struct input_buffer * const ib)
+{
+	ib->head = 0;
+	ib->count = 0;
+	ib->reads = 0;
+}
+
+NO_EXPORT
+size_t
+input_buffer_pending(struct input_buffer const * const ib)
+{
+	return ib->count;
+}
+
+NO_EXPORT
+uint8_t
+input_buffer_peek(struct input_buffer const * const ib, size_t const offset)
+{
+	return ib->data[(ib->head + offset) & INPUT_BUFFER_MASK];
+}
+
+NO_EXPORT
+char const *
+input_buffer_span(
+	struct input_buffer const * const ib,
+	size_t const offset,
+	size_t * const len)
+{
+	size_t const start = (ib->head + offset) & INPUT_BUFFER_MASK;
+	size_t const pending = ib->count - offset;
+
+	*len = (start + pending > INPUT_BUFFER_SIZE) ? INPUT_BUFFER_SIZE - start : pending;
+
+	return (char const *)&ib->data[start];
+}
+
+NO_EXPORT
+size_t
+input_buffer_append(
+	struct input_buffer * const ib,
+	char const * const bytes,
+	size_t const len)
+{
+	size_t const space = INPUT_BUFFER_SIZE - ib->count;
+	size_t const count = (len < space) ? len : space;
+
+	for (size_t i = 0; i < count; i++) {
+		ib->data[(ib->head + ib->count + i) & INPUT_BUFFER_MASK] = bytes[i];
+	}
+	ib->count += count;
+
+	return count;
+}
+
+NO_EXPORT
+void
+input_buffer_consume(struct input_buffer * const ib, size_t const count)
+{
+	ib->head = (ib->head + count) & INPUT_BUFFER_MASK;
+	ib->count -= count;
+	if (ib->count == 0) {
+		/* Keep the free space contiguous where possible. */
+		ib->head = 0;
+	}
+}
+
+NO_EXPORT
+int
+input_buffer_fill(
+	struct input_buffer * const ib,
+	minirl_io_st const * const io,
+	void * const io_ctx,
+	bool const wait)
+{
+	size_t const space = INPUT_BUFFER_SIZE - ib->count;
+
+	if (space == 0) {
+		return 0;
+	}
+	if (io->read == NULL) {
+		return -1;
+	}
+
+	/*
+	 * The free space may wrap around the end of the ring, in which case
+	 * both parts are filled by the same read.
+	 */
+	size_t const tail = (ib->head + ib->count) & INPUT_BUFFER_MASK;
+	size_t const first_len =
+		(tail + space > INPUT_BUFFER_SIZE) ? INPUT_BUFFER_SIZE - tail : space;
+	struct iovec iov[2] = {
+		{ .iov_base = &ib->data[tail], .iov_len = first_len },
+		{ .iov_base = &ib->data[0], .iov_len = space - first_len }
+	};
+	int const iov_count = (iov[1].iov_len > 0) ? 2 : 1;
+	ssize_t const nread = io->read(io_ctx, iov, iov_count, wait);
+
+	ib->reads++;
+	if (nread <= 0) {
+		return nread;
+	}
+	ib->count += nread;
+
+	return nread;
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "minirl.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Must be a power of two. */
+#define INPUT_BUFFER_SIZE 4096
+
+/*
+ * A ring buffer holding bytes read from the input but not yet consumed by
+ * the line editor. Filling it with a single large read means that pasted
+ * text and escape sequences are decoded from memory rather than with one
+ * read() per byte.
+ */
+struct input_buffer {
+	size_t head;    /* Index of the next byte to be consumed. */
+	size_t count;   /* Number of bytes waiting to be consumed. */
+	uint64_t reads; /* Number of calls made to read input. */
+	uint8_t data[INPUT_BUFFER_SIZE];
+};
+
+void
+input_buffer_init(struct input_buffer *ib);
+
+/* Return the number of bytes that have been read but not yet consumed. */
+size_t
+input_buffer_pending(struct input_buffer const *ib);
+
+/*
+ * Return the byte 'offset' bytes past the next unconsumed byte.
+ * 'offset' must be less than the number of pending bytes.
+ */
+uint8_t
+input_buffer_peek(struct input_buffer const *ib, size_t offset);
+
+/*
+ * Return the pending bytes from 'offset' onwards that are contiguous in the
+ * buffer, setting '*len' to the number of them. The rest follow from the
+ * start of the buffer.
+ */
+char const *
+input_buffer_span(struct input_buffer const *ib, size_t offset, size_t *len);
+
+/*
+ * Copy up to 'len' bytes into the free space in the buffer.
+ * Returns the number of bytes copied.
+ */
+size_t
+input_buffer_append(struct input_buffer *ib, char const *bytes, size_t len);
+
+/* Discard 'count' bytes. 'count' must not exceed the number pending. */
+void
+input_buffer_consume(struct input_buffer *ib, size_t count);
+
+/*
+ * Read as many bytes as are available using the 'io' callbacks into the free
+ * space in the buffer with a single call.
+ * If 'wait' is false and no input is available this returns 0 immediately,
+ * otherwise it blocks until at least one byte arrives.
+ * Returns the number of bytes added to the buffer, or -1 on EOF or error.
+ */
+int
+input_buffer_fill(
+	struct input_buffer *ib,
+	minirl_io_st const *io,
+	void *io_ctx,
+	bool wait);
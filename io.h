@@ -21,9 +21,15 @@
 #define io_write(fd, buf, n) \
 	TEMP_FAILURE_RETRY(write((fd), (buf), (n)))
 
+#define io_writev(fd, iov, iovcnt) \
+	TEMP_FAILURE_RETRY(writev((fd), (iov), (iovcnt)))
+
 #define io_read(fd, buf, nbytes) \
 	TEMP_FAILURE_RETRY(read((fd), (buf), (nbytes)))
 
+#define io_readv(fd, iov, iovcnt) \
+	TEMP_FAILURE_RETRY(readv((fd), (iov), (iovcnt)))
+
 #define io_fcntl(fd, flags, ...) \
 	TEMP_FAILURE_RETRY(fcntl((fd), (flags), ##__VA_ARGS__))
 
@@ -6,12 +6,149 @@
 #include <string.h>
 #include <stdlib.h>
 
+#define MIN_KEYMAP_CAPACITY 4
+#define MAX_KEYMAP_CAPACITY 256
+
+/* Find where 'key' is, or would be inserted, in the sorted keys. */
+static size_t
+keymap_position(minirl_keymap_st const * const keymap, uint8_t const key)
+{
+	size_t lo = 0;
+	size_t hi = keymap->count;
+
+	while (lo < hi) {
+		size_t const mid = lo + (hi - lo) / 2;
+
+		if (keymap->keys[mid] < key) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return lo;
+}
+
+/* Get the entry for a key, adding an empty one if there isn't one. */
+static key_handler_st *
+keymap_entry_get(minirl_keymap_st * const keymap, uint8_t const key)
+{
+	size_t const i = keymap_position(keymap, key);
+
+	if (i < keymap->count && keymap->keys[i] == key) {
+		return &keymap->handlers[i];
+	}
+
+	if (keymap->count == keymap->capacity) {
+		size_t capacity = (keymap->capacity == 0)
+				  ? MIN_KEYMAP_CAPACITY
+				  : keymap->capacity * 2;
+
+		if (capacity > MAX_KEYMAP_CAPACITY) {
+			capacity = MAX_KEYMAP_CAPACITY;
+		}
+
+		uint8_t * const keys = realloc(keymap->keys, capacity * sizeof *keys);
+
+		if (keys == NULL) {
+			return NULL;
+		}
+		keymap->keys = keys;
+
+		key_handler_st * const handlers =
+			realloc(keymap->handlers, capacity * sizeof *handlers);
+
+		if (handlers == NULL) {
+			return NULL;
+		}
+		keymap->handlers = handlers;
+		keymap->capacity = capacity;
+	}
+
+	memmove(keymap->keys + i + 1, keymap->keys + i, keymap->count - i);
+	memmove(keymap->handlers + i + 1,
+		keymap->handlers + i,
+		(keymap->count - i) * sizeof *keymap->handlers);
+	keymap->keys[i] = key;
+	keymap->handlers[i] = (key_handler_st){ 0 };
+	keymap->count++;
+
+	return &keymap->handlers[i];
+}
+
+static void
+keymap_destroy(minirl_keymap_st * const keymap)
+{
+	for (size_t i = 0; i < keymap->count; i++) {
+		if (keymap->handlers[i].keymap != NULL) {
+			keymap_destroy(keymap->handlers[i].keymap);
+		}
+	}
+	free(keymap->keys);
+	free(keymap->handlers);
+	free(keymap);
+}
+
+static minirl_keymap_st *
+keymap_copy(minirl_keymap_st const * const keymap)
+{
+	minirl_keymap_st * const copy = minirl_keymap_new();
+
+	if (copy == NULL) {
+		return NULL;
+	}
+	if (keymap->count == 0) {
+		return copy;
+	}
+
+	copy->keys = malloc(keymap->count * sizeof *copy->keys);
+	copy->handlers = calloc(keymap->count, sizeof *copy->handlers);
+	if (copy->keys == NULL || copy->handlers == NULL) {
+		goto fail;
+	}
+	copy->capacity = keymap->count;
+
+	for (size_t i = 0; i < keymap->count; i++) {
+		key_handler_st * const handler = &copy->handlers[i];
+
+		copy->keys[i] = keymap->keys[i];
+		copy->count++;
+		*handler = keymap->handlers[i];
+		if (handler->keymap != NULL) {
+			handler->keymap = keymap_copy(handler->keymap);
+			if (handler->keymap == NULL) {
+				goto fail;
+			}
+		}
+	}
+
+	return copy;
+
+fail:
+	keymap_destroy(copy);
+
+	return NULL;
+}
+
 NO_EXPORT
 minirl_keymap_st *
 minirl_keymap_new(void)
 {
 	minirl_keymap_st * const keymap = calloc(1, sizeof(*keymap));
 
+	if (keymap != NULL) {
+		keymap->refs = 1;
+	}
+
+	return keymap;
+}
+
+NO_EXPORT
+minirl_keymap_st *
+minirl_keymap_ref(minirl_keymap_st * const keymap)
+{
+	__atomic_add_fetch(&keymap->refs, 1, __ATOMIC_RELAXED);
+
 	return keymap;
 }
 
@@ -19,17 +156,28 @@ NO_EXPORT
 void
 minirl_keymap_free(minirl_keymap_st * const keymap)
 {
-	for (size_t i = 0; i < ARRAY_SIZE(keymap->keys); i++) {
-		if (keymap->keys[i].keymap != NULL) {
-			minirl_keymap_free(keymap->keys[i].keymap);
-		}
+	if (keymap != NULL && __atomic_sub_fetch(&keymap->refs, 1, __ATOMIC_ACQ_REL) == 0) {
+		keymap_destroy(keymap);
 	}
-	free(keymap);
 }
 
+NO_EXPORT
+key_handler_st const *
+minirl_keymap_lookup(minirl_keymap_st const * const keymap, uint8_t const key)
+{
+	size_t const i = keymap_position(keymap, key);
+
+	if (i < keymap->count && keymap->keys[i] == key) {
+		return &keymap->handlers[i];
+	}
+
+	return NULL;
+}
+
+NO_EXPORT
 bool
-minirl_bind_key_sequence(
-	minirl_st * const minirl,
+minirl_keymap_bind(
+	minirl_keymap_st * const root,
 	const char * const seq_in,
 	minirl_key_binding_handler_cb const handler,
 	void * const user_ctx)
@@ -42,28 +190,59 @@ minirl_bind_key_sequence(
 		return false;
 	}
 
-	keymap = minirl->keymap;
+	keymap = root;
 	key = seq[0];
 	seq++;
 
 	while (seq[0] != '\0') {
-		if (keymap->keys[key].keymap == NULL) {
-			keymap->keys[key].keymap = minirl_keymap_new();
+		key_handler_st * const entry = keymap_entry_get(keymap, key);
+
+		if (entry == NULL) {
+			return false;
+		}
+		if (entry->keymap == NULL) {
+			entry->keymap = minirl_keymap_new();
 		}
-		if (keymap->keys[key].keymap == NULL) {
+		if (entry->keymap == NULL) {
 			return false;
 		}
-		keymap = keymap->keys[key].keymap;
+		keymap = entry->keymap;
 		key = seq[0];
 		seq++;
 	}
 
-	keymap->keys[key].handler = handler;
-	keymap->keys[key].user_ctx = user_ctx;
+	key_handler_st * const entry = keymap_entry_get(keymap, key);
+
+	if (entry == NULL) {
+		return false;
+	}
+	entry->handler = handler;
+	entry->user_ctx = user_ctx;
 
 	return true;
 }
 
+bool
+minirl_bind_key_sequence(
+	minirl_st * const minirl,
+	const char * const seq,
+	minirl_key_binding_handler_cb const handler,
+	void * const user_ctx)
+{
+	/* Don't change the bindings of other instances sharing the keymap. */
+	if (__atomic_load_n(&minirl->keymap->refs, __ATOMIC_ACQUIRE) > 1) {
+		minirl_keymap_st * const copy = keymap_copy(minirl->keymap);
+
+		if (copy == NULL) {
+			return false;
+		}
+		minirl_keymap_free(minirl->keymap);
+		minirl->keymap = copy;
+	}
+
+	return minirl_keymap_bind(minirl->keymap, seq, handler, user_ctx);
+}
+
 bool
 minirl_bind_key(
 	minirl_st * const minirl,
@@ -76,3 +255,13 @@ minirl_bind_key(
 	return minirl_bind_key_sequence(minirl, seq, handler, user_ctx);
 }
 
+void
+minirl_keymap_share(minirl_st * const minirl, minirl_st * const from)
+{
+	if (minirl->keymap != from->keymap) {
+		minirl_keymap_st * const keymap = minirl_keymap_ref(from->keymap);
+
+		minirl_keymap_free(minirl->keymap);
+		minirl->keymap = keymap;
+	}
+}
@@ -1,6 +1,6 @@
 #pragma once
 
-#define KEYMAP_SIZE 256
+#include <stdint.h>
 
 typedef struct minirl_keymap_st minirl_keymap_st;
 typedef struct key_handler_st key_handler_st;
@@ -11,13 +11,39 @@ struct key_handler_st {
 	void *user_ctx;
 };
 
+/*
+ * A node in the trie of key sequences. Only the keys that are bound, or
+ * start a bound sequence, are stored, sorted by key.
+ * The root of a keymap may be shared between minirl instances, in which
+ * case it is copied before any keys are bound.
+ */
 struct minirl_keymap_st {
-	key_handler_st keys[KEYMAP_SIZE];
+	unsigned refs;
+	uint16_t count;
+	uint16_t capacity;
+	uint8_t *keys;
+	key_handler_st *handlers;
 };
 
 minirl_keymap_st *
 minirl_keymap_new(void);
 
+/* Add a reference to a shared keymap. */
+minirl_keymap_st *
+minirl_keymap_ref(minirl_keymap_st *keymap);
+
+/* Drop a reference to a keymap, freeing it if it is no longer used. */
 void
 minirl_keymap_free(minirl_keymap_st *keymap);
 
+/* Get what is bound to a key, or NULL if nothing is. */
+key_handler_st const *
+minirl_keymap_lookup(minirl_keymap_st const *keymap, uint8_t key);
+
+/* Bind a key sequence to a handler, in a keymap that isn't shared. */
+bool
+minirl_keymap_bind(
+	minirl_keymap_st *keymap,
+	const char *seq,
+	minirl_key_binding_handler_cb handler,
+	void *user_ctx);
@@ -0,0 +1,486 @@
+#include "layout.h"
+#include "char.h"
+#include "export.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define MIN_ENTRIES_CAPACITY 64
+
+NO_EXPORT
+void
+layout_init(struct layout * const layout, struct allocator const * const alloc)
+{
+	memset(layout, 0, sizeof *layout);
+	layout->alloc = alloc;
+}
+
+NO_EXPORT
+void
+layout_free(struct layout * const layout)
+{
+	mem_free(layout->alloc, layout->entries);
+	mem_free(layout->alloc, layout->tail);
+	layout_init(layout, layout->alloc);
+}
+
+static void
+layout_discard(struct layout * const layout)
+{
+	layout->count = 0;
+	layout->tail_count = 0;
+	layout->tail_next = 0;
+}
+
+NO_EXPORT
+void
+layout_reset(struct layout * const layout)
+{
+	layout_discard(layout);
+	layout->configured = false;
+}
+
+/* Find the first entry at or after 'point'. */
+static size_t
+layout_entry_find(struct layout const * const layout, size_t const point)
+{
+	size_t lo = 0;
+	size_t hi = layout->count;
+
+	while (lo < hi) {
+		size_t const mid = lo + (hi - lo) / 2;
+
+		if (layout->entries[mid].point < point) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return lo;
+}
+
+/* Discard the entries from the grapheme that 'point' falls in or follows. */
+static void
+layout_truncate(struct layout * const layout, size_t const point)
+{
+	/*
+	 * Grapheme boundaries before 'point' are unaffected by the change, and
+	 * so are the positions of the graphemes that start before it. The
+	 * grapheme that 'point' falls in or follows may have changed width
+	 * though (e.g. a combining char was added), so it goes too.
+	 */
+	layout->count = layout_entry_find(layout, point);
+	if (layout->count > 0) {
+		layout->count--;
+	}
+}
+
+NO_EXPORT
+void
+layout_invalidate(struct layout * const layout, size_t const point)
+{
+	layout_truncate(layout, point);
+	layout->tail_count = 0;
+	layout->tail_next = 0;
+}
+
+NO_EXPORT
+void
+layout_edit(
+	struct layout * const layout,
+	char const * const line,
+	size_t const len,
+	size_t const point,
+	size_t const removed,
+	size_t const inserted)
+{
+	size_t const end = point + removed;
+
+	/*
+	 * The new tail is made up of the entries after the change, followed
+	 * by those in the old tail that haven't been reached yet, which all
+	 * come after the last entry. The tail is kept to a run of consecutive
+	 * graphemes, so the old tail is dropped if it doesn't carry on from
+	 * the last entry.
+	 */
+	size_t const first = layout_entry_find(layout, end);
+	size_t const from_entries = layout->count - first;
+	size_t old_next = layout->tail_next;
+
+	while (old_next < layout->tail_count && layout->tail[old_next].point < end) {
+		old_next++;
+	}
+	if (from_entries > 0
+	    && old_next < layout->tail_count
+	    && layout->tail[old_next].point
+	       != grapheme_next(line, len, layout->entries[layout->count - 1].point)) {
+		old_next = layout->tail_count;
+	}
+
+	size_t const from_tail = layout->tail_count - old_next;
+	size_t const tail_count = from_entries + from_tail;
+
+	if (tail_count > layout->tail_capacity) {
+		struct layout_entry * const new_tail =
+			mem_realloc(layout->alloc, layout->tail, tail_count * sizeof *new_tail);
+
+		if (new_tail == NULL) {
+			/* The entries are only a cache. */
+			layout_invalidate(layout, point);
+			return;
+		}
+		layout->tail = new_tail;
+		layout->tail_capacity = tail_count;
+	}
+	if (from_tail > 0) {
+		memmove(&layout->tail[from_entries],
+			&layout->tail[old_next],
+			from_tail * sizeof *layout->tail);
+	}
+	if (from_entries > 0) {
+		memcpy(layout->tail,
+		       &layout->entries[first],
+		       from_entries * sizeof *layout->tail);
+	}
+	for (size_t i = 0; i < tail_count; i++) {
+		layout->tail[i].point = layout->tail[i].point + inserted - removed;
+	}
+	layout->tail_count = tail_count;
+	layout->tail_next = 0;
+
+	layout_truncate(layout, point);
+}
+
+/* Advance the wrapping position past a grapheme. */
+static void
+wrap_step(
+	cursor_st * const wrap,
+	size_t const width,
+	bool const newline,
+	size_t const row_width)
+{
+	if (width > 0) {
+		wrap->col += width;
+		if (wrap->col > row_width) {
+			wrap->row++;
+			wrap->col = width;
+		}
+	} else if (newline) {
+		/*
+		 * Special case for '\n', which moves the cursor
+		 * to the beginning of the next line.
+		 * This char won't normally be in the line buffer as it
+		 * normally ends a command, but will be present if the
+		 * character is embedded within quotes.
+		 */
+		wrap->row++;
+		wrap->col = 0;
+	}
+}
+
+static void
+string_wrap(
+	char const * const s,
+	size_t const len,
+	size_t const row_width,
+	cursor_st * const wrap)
+{
+	for (size_t point = 0; point < len;) {
+		size_t next;
+		size_t const width = grapheme_width(s, len, point, &next);
+
+		wrap_step(wrap, width, s[point] == '\n', row_width);
+		point = next;
+	}
+}
+
+NO_EXPORT
+void
+layout_configure(
+	struct layout * const layout,
+	char const * const prompt,
+	size_t const prompt_len,
+	size_t const terminal_width,
+	enum layout_mode const mode)
+{
+	if (layout->configured
+	    && layout->prompt == prompt
+	    && layout->prompt_len == prompt_len
+	    && layout->terminal_width == terminal_width
+	    && layout->mode == mode) {
+		return;
+	}
+
+	layout_discard(layout);
+	layout->prompt = prompt;
+	layout->prompt_len = prompt_len;
+	layout->terminal_width = terminal_width;
+	layout->mode = mode;
+	layout->prompt_end = (cursor_st){ 0 };
+	string_wrap(prompt, prompt_len, terminal_width, &layout->prompt_end);
+	layout->configured = true;
+}
+
+/* Measure the grapheme at 'point' as it will appear on the terminal. */
+static size_t
+layout_grapheme_width(
+	struct layout const * const layout,
+	char const * const line,
+	size_t const len,
+	size_t const point,
+	size_t * const next,
+	bool * const newline)
+{
+	*newline = false;
+
+	switch (layout->mode) {
+	case LAYOUT_MODE_MASKED:
+		*next = grapheme_next(line, len, point);
+		return 1;
+
+	case LAYOUT_MODE_HIDDEN:
+		*next = grapheme_next(line, len, point);
+		return 0;
+
+	case LAYOUT_MODE_TEXT:
+		break;
+	}
+
+	size_t const width = grapheme_width(line, len, point, next);
+
+	*newline = width == 0 && line[point] == '\n';
+
+	return width;
+}
+
+static bool
+layout_entry_add(
+	struct layout * const layout,
+	struct layout_entry const * const entry)
+{
+	if (layout->count == layout->capacity) {
+		size_t const new_capacity = (layout->capacity == 0)
+			? MIN_ENTRIES_CAPACITY : layout->capacity * 2;
+		struct layout_entry * const new_entries =
+			mem_realloc(layout->alloc, layout->entries, new_capacity * sizeof *new_entries);
+
+		if (new_entries == NULL) {
+			return false;
+		}
+		layout->entries = new_entries;
+		layout->capacity = new_capacity;
+	}
+	layout->entries[layout->count++] = *entry;
+
+	return true;
+}
+
+/*
+ * Make sure there are entries for all graphemes that start before 'point'
+ * plus the one at 'point' (if any).
+ * Return the index of the last entry at or before 'point', or -1 if
+ * there is none. As entries are only a cache, running out of memory
+ * just means that fewer entries are available.
+ */
+static long
+layout_extend(
+	struct layout * const layout,
+	char const * const line,
+	size_t const len,
+	size_t const point)
+{
+	if (layout->count == 0 && len > 0) {
+		struct layout_entry entry = {
+			.point = 0,
+			.wrap = layout->prompt_end
+		};
+		size_t next;
+
+		entry.width = layout_grapheme_width(layout, line, len, 0, &next, &entry.newline);
+		if (!layout_entry_add(layout, &entry)) {
+			return -1;
+		}
+	}
+
+	/* Whether the last entry was taken from the tail. */
+	bool in_tail = false;
+
+	while (layout->count > 0) {
+		struct layout_entry const * const last =
+			&layout->entries[layout->count - 1];
+
+		if (last->point >= point) {
+			break;
+		}
+
+		/*
+		 * The tail is a run of consecutive graphemes, so following an
+		 * entry taken from it the next grapheme starts at the next
+		 * tail entry.
+		 */
+		size_t const next = (in_tail && layout->tail_next < layout->tail_count)
+			? layout->tail[layout->tail_next].point
+			: grapheme_next(line, len, last->point);
+
+		if (next >= len) {
+			break;
+		}
+
+		while (layout->tail_next < layout->tail_count
+		       && layout->tail[layout->tail_next].point < next) {
+			layout->tail_next++;
+		}
+		in_tail = layout->tail_next < layout->tail_count
+			  && layout->tail[layout->tail_next].point == next;
+
+		struct layout_entry entry = {
+			.point = next,
+			.wrap = last->wrap
+		};
+		size_t unused;
+
+		wrap_step(&entry.wrap, last->width, last->newline, layout->terminal_width);
+		if (in_tail) {
+			struct layout_entry const * const reached =
+				&layout->tail[layout->tail_next++];
+
+			entry.width = reached->width;
+			entry.newline = reached->newline;
+		} else {
+			entry.width = layout_grapheme_width(layout, line, len, next, &unused, &entry.newline);
+		}
+		if (!layout_entry_add(layout, &entry)) {
+			break;
+		}
+	}
+
+	/* Binary search for the last entry at or before 'point'. */
+	size_t lo = 0;
+	size_t hi = layout->count;
+
+	while (lo < hi) {
+		size_t const mid = lo + (hi - lo) / 2;
+
+		if (layout->entries[mid].point <= point) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return (long)lo - 1;
+}
+
+NO_EXPORT
+void
+layout_cursor_position(
+	struct layout * const layout,
+	char const * const line,
+	size_t const len,
+	size_t const point,
+	cursor_st * const cursor)
+{
+	size_t const row_width = layout->terminal_width;
+	long const index = layout_extend(layout, line, len, point);
+	size_t from = 0;
+	size_t next_width = 0;
+	bool newline;
+
+	*cursor = layout->prompt_end;
+
+	if (index >= 0) {
+		struct layout_entry const * const entry = &layout->entries[index];
+
+		*cursor = entry->wrap;
+		from = entry->point;
+		if (from == point) {
+			next_width = entry->width;
+		}
+	}
+
+	/*
+	 * Walk any graphemes that haven't been cached. This is only needed if
+	 * 'point' is past the end of the line, or in the middle of a grapheme,
+	 * or memory for the cache couldn't be allocated.
+	 */
+	if (from < point) {
+		size_t const end = (point < len) ? point : len;
+
+		while (from < end) {
+			size_t next;
+			size_t const width =
+				layout_grapheme_width(layout, line, end, from, &next, &newline);
+
+			wrap_step(cursor, width, newline, row_width);
+			from = next;
+		}
+		if (point < len) {
+			size_t unused;
+
+			next_width = layout_grapheme_width(layout, line, len, point, &unused, &newline);
+		}
+	}
+
+	if (cursor->col == row_width
+	    || (point < len && cursor->col + next_width > row_width)) {
+		/*
+		 * At EOL or the next character is too wide, so
+		 * move to the next line.
+		 */
+		cursor->row++;
+		cursor->col = 0;
+	}
+}
+
+NO_EXPORT
+size_t
+layout_grapheme_count(
+	struct layout * const layout,
+	char const * const line,
+	size_t const len)
+{
+	long const index = layout_extend(layout, line, len, len);
+	size_t count = 0;
+	size_t from = 0;
+
+	if (index >= 0) {
+		/* There is one cache entry per grapheme. */
+		count = (size_t)index;
+		from = layout->entries[index].point;
+	}
+
+	/* Count any graphemes that couldn't be cached. */
+	while (from < len) {
+		from = grapheme_next(line, len, from);
+		count++;
+	}
+
+	return count;
+}
+
+NO_EXPORT
+bool
+layout_graphemes(
+	struct layout * const layout,
+	char const * const line,
+	size_t const len,
+	struct layout_entry const ** const entries,
+	size_t * const count)
+{
+	long const index = layout_extend(layout, line, len, len);
+
+	*entries = layout->entries;
+	*count = 0;
+	if (len == 0) {
+		return true;
+	}
+	/* The cache may have stopped short of the end of the line. */
+	if (index < 0
+	    || grapheme_next(line, len, layout->entries[index].point) < len) {
+		return false;
+	}
+	*count = (size_t)index + 1;
+
+	return true;
+}
@@ -0,0 +1,135 @@
+#pragma once
+
+#include "alloc.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct cursor_st {
+	int row;
+	int col;
+} cursor_st;
+
+/* How the graphemes in the line are shown on the terminal. */
+enum layout_mode {
+	LAYOUT_MODE_TEXT,       /* Displayed as is. */
+	LAYOUT_MODE_MASKED,     /* Each grapheme is shown as one echo char. */
+	LAYOUT_MODE_HIDDEN      /* Nothing is shown. */
+};
+
+/*
+ * Where each grapheme of the edit line starts on the terminal, relative to
+ * the start of the prompt.
+ * The positions are calculated as they are needed and kept until the line is
+ * changed, at which point only those from the edit point onwards are
+ * discarded. This saves re-wrapping the whole prompt and line from the start
+ * each time the cursor moves.
+ */
+struct layout_entry {
+	size_t point;   /* Offset of the grapheme in the line. */
+	cursor_st wrap; /* Wrapping position reached before this grapheme. */
+	uint8_t width;  /* Number of columns the grapheme occupies. */
+	bool newline;   /* The grapheme is a '\n'. */
+};
+
+struct layout {
+	struct layout_entry *entries;
+	size_t count;
+	size_t capacity;
+
+	/*
+	 * The entries for the graphemes that followed the last change to the
+	 * line, with their points adjusted for the change. Graphemes after a
+	 * change are unaffected by it, so once the entries reach one of these
+	 * again its width is reused rather than measured again.
+	 */
+	struct layout_entry *tail;
+	size_t tail_count;
+	size_t tail_next;       /* The first tail entry not yet reached. */
+	size_t tail_capacity;
+
+	/* What the entries were calculated for. */
+	char const *prompt;
+	size_t prompt_len;
+	size_t terminal_width;
+	enum layout_mode mode;
+	cursor_st prompt_end;
+	bool configured;
+	struct allocator const *alloc;
+};
+
+void
+layout_init(struct layout *layout, struct allocator const *alloc);
+
+void
+layout_free(struct layout *layout);
+
+/* Discard all positions, e.g. because a new line is being edited. */
+void
+layout_reset(struct layout *layout);
+
+/*
+ * Discard the positions that may be affected by the line being changed at
+ * 'point'.
+ */
+void
+layout_invalidate(struct layout *layout, size_t point);
+
+/*
+ * Update the positions for the 'removed' bytes at 'point' being replaced by
+ * 'inserted' bytes, keeping those for the rest of the line. Called with the
+ * line as it is before the change.
+ */
+void
+layout_edit(
+	struct layout *layout,
+	char const *line,
+	size_t len,
+	size_t point,
+	size_t removed,
+	size_t inserted);
+
+/*
+ * Set the prompt, terminal width and display mode that positions are
+ * calculated for. Positions are discarded if any of these have changed.
+ */
+void
+layout_configure(
+	struct layout *layout,
+	char const *prompt,
+	size_t prompt_len,
+	size_t terminal_width,
+	enum layout_mode mode);
+
+/*
+ * Get the position the cursor should be placed in when the edit point is at
+ * 'point' in 'line'. If the grapheme at 'point' doesn't fit on the current
+ * row the cursor is placed at the start of the next row.
+ */
+void
+layout_cursor_position(
+	struct layout *layout,
+	char const *line,
+	size_t len,
+	size_t point,
+	cursor_st *cursor);
+
+/*
+ * Get the entries for all of the graphemes in 'line', in order, setting
+ * '*count' to the number of them. Returns false if they aren't all
+ * available, as happens if memory for them runs out.
+ */
+bool
+layout_graphemes(
+	struct layout *layout,
+	char const *line,
+	size_t len,
+	struct layout_entry const **entries,
+	size_t *count);
+
+/*
+ * Get the number of graphemes in 'line'.
+ */
+size_t
+layout_grapheme_count(struct layout *layout, char const *line, size_t len);
@@ -1,7 +1,9 @@
 #include "minirl.h"
+#include "ascii.h"
 #include "buffer.h"
 #include "char.h"
 #include "export.h"
+#include "fd_io.h"
 #include "io.h"
 #include "private.h"
 #include "utils.h"
@@ -10,20 +12,49 @@
 #include <errno.h>
 #include <fcntl.h>
 #include <inttypes.h>
+#include <poll.h>
 #include <signal.h>
 #include <stdarg.h>
 #include <stdbool.h>
 #include <stdlib.h>
 #include <string.h>
-#include <sys/ioctl.h>
 #include <sys/stat.h>
 #include <sys/ttydefaults.h>
 #include <sys/types.h>
+#include <time.h>
 #include <unistd.h>
 
 
 #define DEFAULT_TERMINAL_WIDTH 80
+#define DEFAULT_REFRESH_BUDGET_MS 40
+#define DEFAULT_COMPLETION_QUERY_ITEMS 100
+#define NO_TTY_READ_SIZE 65536
+#define OUTPUT_KEEP_MAX 65536
 #define ESCAPESTR "\x1b"
+#define BRACKETED_PASTE_ENABLE ESCAPESTR "[?2004h"
+#define BRACKETED_PASTE_DISABLE ESCAPESTR "[?2004l"
+
+/* Count an event for minirl_stats_get(), if the stats are enabled. */
+#define STATS_ADD(minirl, counter, n) \
+	do { \
+		if ((minirl)->stats.enabled) { \
+			(minirl)->stats.counts.counter += (n); \
+		} \
+	} while (0)
+
+#ifdef ENABLE_TRACE
+#define TRACE_KEY_WANTED(minirl) ((minirl)->trace.key != NULL)
+#define TRACE_KEY(minirl, key, handler, elapsed_ns) \
+	do { \
+		if ((minirl)->trace.key != NULL) { \
+			(minirl)->trace.key((minirl), (key), (handler), (elapsed_ns), \
+					    (minirl)->trace.key_ctx); \
+		} \
+	} while (0)
+#else
+#define TRACE_KEY_WANTED(minirl) false
+#define TRACE_KEY(minirl, key, handler, elapsed_ns) do { } while (0)
+#endif
 
 
 enum KEY_ACTION
@@ -35,77 +66,199 @@ enum KEY_ACTION
 	BACKSPACE =  127	/* Backspace */
 };
 
+/*
+ * All output is queued in the output buffer, and only written when the
+ * queue is flushed. Flushing happens before waiting for more input and
+ * before returning to the caller, so a key (or a burst of keys) normally
+ * results in a single write however many parts of the line it updated.
+ */
+static bool
+output_append(minirl_st * const minirl, char const * const data, size_t const len)
+{
+	return buffer_append(&minirl->output, data, len);
+}
+
+static void
+output_flush(minirl_st * const minirl)
+{
+	struct buffer * const queue = &minirl->output;
+
+	if (queue->len == 0) {
+		return;
+	}
+
+	struct iovec const iov = { .iov_base = queue->b, .iov_len = queue->len };
+
+	STATS_ADD(minirl, writes, 1);
+	if (minirl->io->write(minirl->io_ctx, &iov, 1)) {
+		STATS_ADD(minirl, bytes_written, queue->len);
+	}
+
+	/*
+	 * After an error some of the output may well have been written, so
+	 * giving it again could repeat it, and a dead fd would have it queue
+	 * up for ever. It's dropped either way, and the memory of an unusually
+	 * large update isn't kept for the rest of the session.
+	 */
+	if (queue->capacity > OUTPUT_KEEP_MAX) {
+		buffer_clear(queue);
+	} else {
+		buffer_reset(queue);
+	}
+	if (minirl->io->flush != NULL) {
+		minirl->io->flush(minirl->io_ctx);
+	}
+}
+
+/*
+ * Output from outside of a key handler is flushed straight away, as there
+ * may not be another flush until more input arrives.
+ */
+static void
+output_flush_if_idle(minirl_st * const minirl)
+{
+	if (!minirl->state.in_key_handler) {
+		output_flush(minirl);
+	}
+}
+
 typedef struct internal_line_buffer_st {
-	size_t edit_point;
 	size_t end;
-	char * alloced_buffer;
 	char const * buffer;
 } internal_line_buffer_st;
 
+/*
+ * Get a string of at least 'count' echo chars. The string is kept from one
+ * call to the next, so it only needs extending when the line gets longer.
+ */
+static char const *
+echo_mask_get(minirl_st * const minirl, size_t const count)
+{
+	struct buffer * const mask = &minirl->echo_mask;
+	char const echo_ch = minirl->options.echo.ch;
+
+	if (count == 0) {
+		return "";
+	}
+	if (mask->len > 0 && mask->b[0] != echo_ch) {
+		buffer_reset(mask);
+	}
+	if (mask->len < count) {
+		if (count > mask->capacity
+		    && !buffer_grow(mask, count - mask->capacity)) {
+			return NULL;
+		}
+		memset(mask->b + mask->len, echo_ch, count - mask->len);
+		mask->len = count;
+		mask->b[mask->len] = '\0';
+	}
+
+	return mask->b;
+}
+
 static bool
 internal_line_buffer_init(
     internal_line_buffer_st * const internal,
-    minirl_state_st * const l,
-    echo_st const * const echo)
+    minirl_st * const minirl)
 {
 	/*
-	 * Create a copy of the line buffer. If the echo char is enabled,
-	 * replace the real characters with the echo character if one is
-	 * defined, else don't replace with anything.
-	 * This representation will be used to determine what should be printed
-	 * to the display, and where to place the cursor.
+	 * Get the representation of the line buffer that is written to the
+	 * display. If the echo char is enabled, the real characters are
+	 * replaced with the echo character if one is defined, else don't
+	 * replace with anything.
 	 * As UTF-8 chars may be wider than the echo char (which is plain ASCII)
 	 * the cursor may be located at a different position when using an echo
 	 * char.
 	 */
+	minirl_state_st * const l = &minirl->state;
+	echo_st const * const echo = &minirl->options.echo;
+
 	if (!echo->disable) {
 		/* Simply echo the line. */
-		internal->edit_point = l->pos;
 		internal->end = l->len;
-		internal->alloced_buffer = NULL;
 		internal->buffer = l->line_buf->b;
 	} else if (echo->ch == '\0') {
-		internal->edit_point = 0;
 		internal->end = 0;
-		internal->alloced_buffer = NULL;
 		internal->buffer = "";
 	} else {
-		/* Replace the line with echo char. */
-		internal->edit_point = 0;
-		internal->end = 0;
-		for (size_t i = 0; ; i = grapheme_next(l->line_buf->b, l->len, i)) {
-			if (i == l->pos) {
-				internal->edit_point = internal->end;
-			}
-			if (i >= l->len) {
-				break;
-			}
-			internal->end++;
-		}
-
-		internal->alloced_buffer = chrdup(echo->ch, internal->end);
-		internal->buffer = internal->alloced_buffer;
+		/* Replace the line with an echo char per grapheme. */
+		internal->end = layout_grapheme_count(l->layout, l->line_buf->b, l->len);
+		internal->buffer = echo_mask_get(minirl, internal->end);
 	}
 
 	return internal->buffer != NULL;
 }
 
-static void
-internal_line_buffer_free(internal_line_buffer_st const * const internal)
+int
+minirl_printf(minirl_st * const minirl, char const * const fmt, ...)
 {
-	free(internal->alloced_buffer);
+	struct buffer * const queue = &minirl->output;
+	char small_text[256];
+	va_list args;
+	int len;
+
+	va_start(args, fmt);
+	len = vsnprintf(small_text, sizeof small_text, fmt, args);
+	va_end(args);
+
+	if (len >= (int)sizeof small_text) {
+		/* Format long text straight into the output queue. */
+		size_t const space = (queue->b != NULL) ? queue->capacity - queue->len : 0;
+
+		if ((size_t)len > space && !buffer_grow(queue, len - space)) {
+			return -1;
+		}
+		/* There is always room for the NUL terminator. */
+		va_start(args, fmt);
+		vsnprintf(queue->b + queue->len, len + 1, fmt, args);
+		va_end(args);
+		queue->len += len;
+		output_flush_if_idle(minirl);
+	} else if (len > 0) {
+		if (!output_append(minirl, small_text, len)) {
+			len = -1;
+		}
+		output_flush_if_idle(minirl);
+	}
+
+	return len;
 }
 
 int
-minirl_printf(minirl_st * const minirl, char const * const fmt, ...)
+minirl_async_print(minirl_st * const minirl, char const * const fmt, ...)
 {
+	char small_text[256];
+	char *text = small_text;
 	va_list args;
 	int len;
 
 	va_start(args, fmt);
-	len = vfprintf(minirl->out.stream, fmt, args);
+	len = vsnprintf(small_text, sizeof small_text, fmt, args);
 	va_end(args);
 
+	if (len >= (int)sizeof small_text) {
+		text = malloc(len + 1);
+		if (text == NULL) {
+			return -1;
+		}
+		va_start(args, fmt);
+		vsnprintf(text, len + 1, fmt, args);
+		va_end(args);
+	}
+
+	if (len > 0) {
+		if (!wakeup_open(&minirl->wakeup)
+		    || !print_queue_push(&minirl->print_queue, text, len)) {
+			len = -1;
+		} else {
+			wakeup_signal(&minirl->wakeup);
+		}
+	}
+
+	if (text != small_text) {
+		free(text);
+	}
+
 	return len;
 }
 
@@ -133,10 +286,43 @@ minirl_state_cursor_refresh_required(minirl_state_st * const l)
 	l->flags.cursor_refresh_required = true;
 }
 
+static bool
+minirl_state_refresh_pending(minirl_state_st const * const l)
+{
+	return l->flags.refresh_required || l->flags.cursor_refresh_required;
+}
+
+/*
+ * Called whenever the contents of the line buffer change at or after 'point'.
+ */
+static void
+minirl_state_line_changed(minirl_state_st * const l, size_t const point)
+{
+	layout_invalidate(l->layout, point);
+	l->history_prefix.valid = false;
+}
+
+/*
+ * Called before the 'removed' bytes at 'point' are replaced by 'inserted'
+ * bytes, leaving the rest of the line as it was.
+ */
+static void
+minirl_state_line_edited(
+	minirl_state_st * const l,
+	size_t const point,
+	size_t const removed,
+	size_t const inserted)
+{
+	layout_edit(l->layout, l->line_buf->b, l->len, point, removed, inserted);
+	l->history_prefix.valid = false;
+}
+
 static void
 minirl_state_reset_line_state(minirl_state_st * const l)
 {
 	l->max_rows = 1;
+	/* What is on the terminal is no longer known. */
+	l->shadow_valid = false;
 	minirl_state_refresh_required(l);
 }
 
@@ -258,30 +444,137 @@ disable_raw_mode(minirl_st * const minirl, int const fd)
 	}
 }
 
+/*
+ * SIGWINCH handling is process wide. The handler bumps a generation count
+ * so that each instance can tell if its cached terminal width is stale, and
+ * writes to a pipe to wake up any instance waiting for input.
+ */
+static int winch_pipe[2] = { -1, -1 };
+static volatile sig_atomic_t winch_generation;
+static struct sigaction winch_previous_action;
+
+static void
+winch_signal_handler(int const sig, siginfo_t * const info, void * const uctx)
+{
+	int const saved_errno = errno;
+	char const c = 0;
+
+	winch_generation++;
+	if (io_write(winch_pipe[1], &c, sizeof c) == -1) {
+		/* The pipe is full, so a wakeup is already pending. */
+	}
+
+	/*
+	 * Let any handler the application installed see the signal too,
+	 * before errno is restored in case it changes it.
+	 */
+	if ((winch_previous_action.sa_flags & SA_SIGINFO) != 0) {
+		if (winch_previous_action.sa_sigaction != NULL) {
+			winch_previous_action.sa_sigaction(sig, info, uctx);
+		}
+	} else if (winch_previous_action.sa_handler != SIG_DFL
+		   && winch_previous_action.sa_handler != SIG_IGN) {
+		winch_previous_action.sa_handler(sig);
+	}
+	errno = saved_errno;
+}
+
+static bool
+winch_handler_install(void)
+{
+	if (winch_pipe[0] != -1) {
+		return true;
+	}
+	if (pipe2(winch_pipe, O_NONBLOCK | O_CLOEXEC) == -1) {
+		return false;
+	}
+
+	struct sigaction action = { .sa_sigaction = winch_signal_handler };
+
+	sigemptyset(&action.sa_mask);
+	action.sa_flags = SA_SIGINFO | SA_RESTART;
+	if (sigaction(SIGWINCH, &action, &winch_previous_action) == -1) {
+		close(winch_pipe[0]);
+		close(winch_pipe[1]);
+		winch_pipe[0] = winch_pipe[1] = -1;
+		return false;
+	}
+
+	return true;
+}
+
+static void
+winch_pipe_drain(void)
+{
+	char buf[64];
+
+	while (io_read(winch_pipe[0], buf, sizeof buf) > 0) {
+		/* Just discard the wakeups. */
+	}
+}
+
+static int
+terminal_width_query(minirl_st * const minirl)
+{
+	int cols = 0;
+
+	if (minirl->io->width != NULL) {
+		cols = minirl->io->width(minirl->io_ctx);
+	}
+	if (cols <= 0) {
+		cols = DEFAULT_TERMINAL_WIDTH;
+	}
+	if (recorder_active(&minirl->recorder)) {
+		recorder_width(&minirl->recorder, cols);
+	}
+
+	return cols;
+}
+
 /*
  * Try to get the number of columns in the current terminal, or assume 80
  * if it fails.*
+ * If resize tracking is enabled the width is only queried again after the
+ * terminal has been resized.
  */
 int
 minirl_terminal_width(minirl_st * const minirl)
 {
-	int cols = DEFAULT_TERMINAL_WIDTH;
-	struct winsize ws;
+	if (!minirl->options.track_resize) {
+		return terminal_width_query(minirl);
+	}
+
+	sig_atomic_t const generation = winch_generation;
 
-	if (ioctl(minirl->out.fd, TIOCGWINSZ, &ws) != -1 && ws.ws_col != 0) {
-		cols = ws.ws_col;
+	if (minirl->terminal.width == 0
+	    || minirl->terminal.generation != generation) {
+		minirl->terminal.width = terminal_width_query(minirl);
+		minirl->terminal.generation = generation;
 	}
 
-	return cols;
+	return minirl->terminal.width;
+}
+
+bool
+minirl_resize_tracking_enable(minirl_st * const minirl)
+{
+	if (!winch_handler_install()) {
+		return false;
+	}
+	minirl->terminal.width = 0;
+	minirl->options.track_resize = true;
+
+	return true;
 }
 
 /* Clear the screen. Used to handle ctrl+l */
 void
 minirl_screen_clear(minirl_st * const minirl)
 {
-	if (io_write(minirl->out.fd, "\x1b[H\x1b[2J", 7) <= 0) {
+	if (!output_append(minirl, "\x1b[H\x1b[2J", 7)) {
 		/* nothing to do, just to avoid warning. */
 	}
+	output_flush_if_idle(minirl);
 
 	minirl_state_st * const l = &minirl->state;
 
@@ -289,65 +582,38 @@ minirl_screen_clear(minirl_st * const minirl)
 	minirl_state_refresh_required(l);
 }
 
-static void
-string_wrap(
-	char const * const s,
-	size_t const len,
-	size_t const row_width,
-	cursor_st * const cursor)
+static enum layout_mode
+layout_mode_get(echo_st const * const echo)
 {
-	for (size_t point = 0; point < len;) {
-		size_t next;
-		size_t const width = grapheme_width(s, len, point, &next);
-
-		if (width > 0) {
-			cursor->col += width;
-			if (cursor->col > row_width) {
-				cursor->row++;
-				cursor->col = width;
-			}
-		} else if (s[point] == '\n') {
-			/*
-			 * Special case for '\n', which moves the cursor
-			 * to the beginning of the next line.
-			 * This char won't normally be in the line buffer as it
-			 * normally ends a command, but will be present if the
-			 * character is embedded within quotes.
-			 */
-			cursor->row++;
-			cursor->col = 0;
-		}
-		point = next;
+	if (!echo->disable) {
+		return LAYOUT_MODE_TEXT;
+	}
+	if (echo->ch == '\0') {
+		return LAYOUT_MODE_HIDDEN;
 	}
+
+	return LAYOUT_MODE_MASKED;
 }
 
+/*
+ * Calculate where the cursor should be when the edit position is at 'point'
+ * in the line buffer. The positions of the graphemes in the line are cached
+ * so that this normally doesn't require re-wrapping the prompt and line.
+ */
 static void
 calculate_cursor_position(
-    minirl_state_st * const l,
+    minirl_st * const minirl,
     cursor_st * const cursor,
-    size_t const point,
-    internal_line_buffer_st const * const internal)
+    size_t const point)
 {
-	*cursor = (cursor_st){ 0 };
-
-	string_wrap(l->prompt, l->prompt_len, l->terminal_width, cursor);
-	if (internal != NULL) {
-		string_wrap(internal->buffer, point, l->terminal_width, cursor);
+	minirl_state_st * const l = &minirl->state;
 
-		if (cursor->col == l->terminal_width
-		    || (point < internal->end
-			&& cursor->col + grapheme_width(internal->buffer,
-							internal->end,
-							point,
-							NULL) > l->terminal_width)) {
-			/*
-			 * At EOL or the next character is too wide, so
-			 * move to the next line.
-			 */
-			cursor->row++;
-			cursor->col = 0;
-		}
-	}
+	layout_configure(l->layout,
+			 l->prompt,
+			 l->prompt_len,
+			 l->terminal_width,
+			 layout_mode_get(&minirl->options.echo));
+	layout_cursor_position(l->layout, l->line_buf->b, l->len, point, cursor);
 }
 
 static void
@@ -360,35 +626,35 @@ emit_row_clear(struct buffer * const ab)
 }
 
 static void
-emit_cursor_up(struct buffer * const ab, size_t const count)
+emit_cursor_move(struct buffer * const ab, size_t const count, char const direction)
 {
-	char buf[10];
+	buffer_append(ab, ESCAPESTR "[", strlen(ESCAPESTR "["));
+	buffer_append_number(ab, count);
+	buffer_append(ab, &direction, sizeof direction);
+}
 
-	buffer_snprintf(ab, buf, sizeof buf, ESCAPESTR "[%zuA", count);
+static void
+emit_cursor_up(struct buffer * const ab, size_t const count)
+{
+	emit_cursor_move(ab, count, 'A');
 }
 
 static void
 emit_cursor_down(struct buffer * const ab, size_t const count)
 {
-	char buf[10];
-
-	buffer_snprintf(ab, buf, sizeof buf, ESCAPESTR "[%zuB", count);
+	emit_cursor_move(ab, count, 'B');
 }
 
 static void
 emit_cursor_right(struct buffer * const ab, size_t const count)
 {
-	char buf[10];
-
-	buffer_snprintf(ab, buf, sizeof buf, ESCAPESTR "[%zuC", count);
+	emit_cursor_move(ab, count, 'C');
 }
 
 static void
 emit_cursor_left(struct buffer * const ab, size_t const count)
 {
-	char buf[10];
-
-	buffer_snprintf(ab, buf, sizeof buf, ESCAPESTR "[%zuD", count);
+	emit_cursor_move(ab, count, 'D');
 }
 
 static void
@@ -432,21 +698,13 @@ emit_cursor_adjustment(
 
 }
 
-static bool
+static void
 minirl_refresh_cursor(minirl_st * const minirl)
 {
-	bool success = true;
 	minirl_state_st * const l = &minirl->state;
-	internal_line_buffer_st internal;
-
-	if (!internal_line_buffer_init(&internal, l, &minirl->options.echo)) {
-		minirl_state_had_error(l);
-		success = false;
-		goto done;
-	}
-
 	cursor_st current_cursor;
-	calculate_cursor_position(l, &current_cursor, internal.edit_point, &internal);
+
+	calculate_cursor_position(minirl, &current_cursor, l->pos);
 
 	/* Check that the cursor has actually moved. */
 	if (current_cursor.row == l->previous_cursor.row
@@ -466,86 +724,216 @@ minirl_refresh_cursor(minirl_st * const minirl)
 		goto done;
 	}
 
-	struct buffer ab;
-
-	buffer_init(&ab, 20);
-
 	/* Update the cursor position. */
-	emit_cursor_adjustment(&ab, &current_cursor, &l->previous_cursor);
+	emit_cursor_adjustment(&minirl->output, &current_cursor, &l->previous_cursor);
+	STATS_ADD(minirl, cursor_refreshes, 1);
 
 	l->previous_cursor = current_cursor;
 	l->flags.cursor_refresh_required = false;
 
-	if (io_write(minirl->out.fd, ab.b, ab.len) == -1) {
-		success = false;
-	}
-
-	buffer_clear(&ab);
-
 done:
-	internal_line_buffer_free(&internal);
+	return;
+}
 
-	return success;
+/*
+ * Move the cursor to 'row'. Rows below those already in use by the edit line
+ * are created by writing newlines from the last row in use.
+ */
+static void
+emit_move_to_row(
+	struct buffer * const ab,
+	cursor_st * const cursor,
+	size_t * const rows_in_use,
+	int const row)
+{
+	if (row < *rows_in_use) {
+		emit_row_adjustment(ab, row, cursor->row);
+		cursor->row = row;
+		return;
+	}
+
+	emit_row_adjustment(ab, *rows_in_use - 1, cursor->row);
+	for (; *rows_in_use <= row; (*rows_in_use)++) {
+		buffer_append(ab, "\r\n", strlen("\r\n"));
+	}
+	cursor->row = row;
+	cursor->col = 0;
 }
 
-/* Multi line low level line refresh.
- *
- * Rewrite the currently edited line according to the buffer content,
- * cursor position, and number of columns of the terminal.
+/*
+ * Bring one row of the display up to date, starting from the first grapheme
+ * that differs from what was previously written.
+ * 'cursor' tracks the terminal cursor position.
  */
-static bool
-minirl_refresh_line(minirl_st * const minirl)
+static void
+emit_row_update(
+	struct buffer * const ab,
+	struct display const * const old,
+	struct display const * const new,
+	int const row,
+	cursor_st * const cursor,
+	size_t * const rows_in_use)
 {
-	bool success = true;
-	minirl_state_st * const l = &minirl->state;
-	internal_line_buffer_st internal;
+	struct display_row const * const new_row =
+		(row < new->num_rows) ? &new->rows[row] : NULL;
+	struct display_row const * const old_row =
+		(row < old->num_rows) ? &old->rows[row] : NULL;
+	bool const is_new_row = row >= *rows_in_use;
+
+	if (new_row == NULL) {
+		/* The line has shrunk, so clear the row if anything was on it. */
+		if (old_row != NULL && old_row->width > 0 && !is_new_row) {
+			emit_row_adjustment(ab, row, cursor->row);
+			emit_row_clear(ab);
+			cursor->row = row;
+			cursor->col = 0;
+		}
+		return;
+	}
 
-	if (!internal_line_buffer_init(&internal, l, &minirl->options.echo)) {
-		minirl_state_had_error(l);
-		success = false;
-		goto done;
+	size_t new_point = new_row->start;
+	size_t old_point = 0;
+	size_t old_end = 0;
+	size_t col = 0;
+
+	if (old_row != NULL) {
+		old_point = old_row->start;
+		old_end = old_row->end;
+
+		if (!is_new_row
+		    && old_end - old_point == new_row->end - new_point
+		    && old_row->width == new_row->width
+		    && memcmp(&old->text.b[old_point],
+			      &new->text.b[new_point],
+			      old_end - old_point) == 0) {
+			/* Nothing on this row has changed. */
+			return;
+		}
 	}
 
-	l->terminal_width = minirl_terminal_width(minirl);
+	/* Skip over the unchanged graphemes at the start of the row. */
+	while (new_point < new_row->end && old_point < old_end) {
+		size_t new_next;
+		size_t const width = grapheme_width(new->text.b,
+						    new->text.len,
+						    new_point,
+						    &new_next);
+		size_t const old_next =
+			grapheme_next(old->text.b, old->text.len, old_point);
+		size_t const len = new_next - new_point;
+
+		if (old_next - old_point != len
+		    || memcmp(&new->text.b[new_point],
+			      &old->text.b[old_point],
+			      len) != 0) {
+			break;
+		}
+		col += width;
+		new_point = new_next;
+		old_point = old_next;
+	}
 
-	cursor_st current_cursor;
-	cursor_st line_end_cursor;
-	calculate_cursor_position(l, &current_cursor, internal.edit_point, &internal);
-	calculate_cursor_position(l, &line_end_cursor, internal.end, &internal);
+	if (new_point == new_row->end && old_point == old_end && !is_new_row) {
+		/* Nothing on this row has changed. */
+		return;
+	}
 
-	struct buffer ab;
+	cursor_st const start = { .row = row, .col = col };
 
-	buffer_init(&ab, 20);
+	emit_move_to_row(ab, cursor, rows_in_use, row);
+	emit_column_adjustment(ab, start.col, cursor->col);
+	buffer_append(ab, &new->text.b[new_point], new_row->end - new_point);
+	cursor->col = new_row->width;
 
-	/*
-	 * First step: clear all the lines used before.
-	 * To do so start by going to the last row.
-	 */
+	if (cursor->col >= new->terminal_width) {
+		/*
+		 * The row is full. Where the terminal leaves the cursor now
+		 * varies, so put it somewhere known.
+		 */
+		buffer_append(ab, "\r", strlen("\r"));
+		cursor->col = 0;
+	} else if (is_new_row
+		   || (old_row != NULL && old_row->width > new_row->width)) {
+		buffer_append(ab, ESCAPESTR "[0K", strlen(ESCAPESTR "[0K"));
+	}
+}
+
+/*
+ * Write only the rows, or the ends of rows, that differ between what is on
+ * the terminal and what should be.
+ */
+static void
+emit_line_update(
+	struct buffer * const ab,
+	minirl_state_st * const l,
+	struct display const * const old,
+	struct display const * const new,
+	cursor_st const * const current_cursor)
+{
+	cursor_st cursor = l->previous_cursor;
+	size_t rows_in_use = l->max_rows;
+	size_t const num_rows =
+		(new->num_rows > old->num_rows) ? new->num_rows : old->num_rows;
+
+	for (size_t row = 0; row < num_rows; row++) {
+		emit_row_update(ab, old, new, row, &cursor, &rows_in_use);
+	}
+
+	/* Move the cursor to edit position. */
+	emit_move_to_row(ab, &cursor, &rows_in_use, current_cursor->row);
+	emit_column_adjustment(ab, current_cursor->col, cursor.col);
+
+	l->max_rows = rows_in_use;
+}
+
+/*
+ * Clear all rows used by the edit line, leaving the cursor at the start of
+ * the first one.
+ */
+static void
+emit_line_clear(struct buffer * const ab, minirl_state_st const * const l)
+{
+	/* Start by going to the last row. */
 	if (l->max_rows > 1) {
 		unsigned const down_count = l->max_rows - l->previous_cursor.row - 1;
 
 		if (down_count > 0) {
 			/* Move down. to last row. */
-			emit_cursor_down(&ab, down_count);
+			emit_cursor_down(ab, down_count);
 		}
 
 		/* Now for every row clear it, then go up. */
 		for (size_t j = 0; j < l->max_rows - 1; j++) {
-			emit_row_clear(&ab);
-			emit_cursor_up(&ab, 1);
+			emit_row_clear(ab);
+			emit_cursor_up(ab, 1);
 		}
 	}
 
-	/*
-	 * Go to beginning of the line and clear to the end.
-	 * This means the prompt will also be cleared, so will need to be
-	 * output afresh.
-	 */
-	emit_row_clear(&ab);
+	/* Go to beginning of the line and clear to the end. */
+	emit_row_clear(ab);
+}
+
+/*
+ * Clear all rows used by the edit line and write the prompt and the line
+ * afresh.
+ */
+static void
+emit_line_repaint(
+	struct buffer * const ab,
+	minirl_state_st * const l,
+	struct display const * const new,
+	cursor_st const * const current_cursor,
+	cursor_st const * const line_end_cursor)
+{
+	/*
+	 * First step: clear all the lines used before.
+	 * This means the prompt will also be cleared, so will need to be
+	 * output afresh.
+	 */
+	emit_line_clear(ab, l);
 
 	/* Write the prompt and the current buffer content */
-	buffer_append(&ab, l->prompt, strlen(l->prompt));
-	buffer_append(&ab, internal.buffer, internal.end);
+	buffer_append(ab, new->text.b, new->text.len);
 
 	/*
 	 * If we are at the very RHS of the screen with our cursor, we need to
@@ -554,17 +942,113 @@ minirl_refresh_line(minirl_st * const minirl)
 	 * If the last character on the row is a '\n' there is no need to emit
 	 * the newline because that character already moved the cursor.
 	 */
-	if (line_end_cursor.row > 0
-	    && line_end_cursor.col == 0
-	    && internal.buffer[internal.end - 1] != '\n') {
-		buffer_append(&ab, "\n\r", strlen("\n\r"));
+	if (line_end_cursor->row > 0
+	    && line_end_cursor->col == 0
+	    && (new->text.len == 0 || new->text.b[new->text.len - 1] != '\n')) {
+		buffer_append(ab, "\n\r", strlen("\n\r"));
 	}
 
 	/*
 	 * Move the cursor to edit position. At present it will be at the end of
 	 * the current line.
 	 */
-	emit_cursor_adjustment(&ab, &current_cursor, &line_end_cursor);
+	emit_cursor_adjustment(ab, current_cursor, line_end_cursor);
+}
+
+/*
+ * The rows on the terminal can only be updated piecemeal if they were
+ * written with the same terminal width and prompt.
+ */
+static bool
+display_can_be_updated(
+	minirl_st * const minirl,
+	struct display const * const new)
+{
+	minirl_state_st const * const l = &minirl->state;
+	struct display const * const old = &minirl->shadow;
+
+	return l->shadow_valid
+		&& old->terminal_width == new->terminal_width
+		&& old->prompt_len == new->prompt_len
+		&& memcmp(old->text.b, new->text.b, new->prompt_len) == 0;
+}
+
+/* Record 'new' as being what is now displayed on the terminal. */
+static void
+display_shadow_update(minirl_st * const minirl, struct display * const new)
+{
+	struct display const tmp = minirl->shadow;
+
+	minirl->shadow = *new;
+	*new = tmp;
+	minirl->state.shadow_valid = true;
+}
+
+/* Multi line low level line refresh.
+ *
+ * Rewrite the currently edited line according to the buffer content,
+ * cursor position, and number of columns of the terminal.
+ * Where possible only the parts of the line that have changed since it was
+ * last written are output.
+ */
+static bool
+minirl_refresh_line(minirl_st * const minirl)
+{
+	bool success = true;
+	minirl_state_st * const l = &minirl->state;
+	internal_line_buffer_st internal;
+
+	STATS_ADD(minirl, full_refreshes, 1);
+	l->terminal_width = minirl_terminal_width(minirl);
+
+	cursor_st current_cursor;
+	cursor_st line_end_cursor;
+	calculate_cursor_position(minirl, &current_cursor, l->pos);
+	calculate_cursor_position(minirl, &line_end_cursor, l->len);
+
+	if (!internal_line_buffer_init(&internal, minirl)) {
+		minirl_state_had_error(l);
+		success = false;
+		goto done;
+	}
+
+	struct display * const new = &minirl->display;
+	/*
+	 * Text shown as it is takes up the same columns as the layout used
+	 * for the cursor has already worked out, so they can be reused.
+	 */
+	struct layout_entry const *graphemes = NULL;
+	size_t grapheme_count = 0;
+
+	if (l->layout->mode == LAYOUT_MODE_TEXT
+	    && !layout_graphemes(l->layout,
+				 l->line_buf->b,
+				 l->len,
+				 &graphemes,
+				 &grapheme_count)) {
+		graphemes = NULL;
+	}
+	if (!display_build(new,
+			   l->prompt,
+			   l->prompt_len,
+			   internal.buffer,
+			   internal.end,
+			   graphemes,
+			   grapheme_count,
+			   l->terminal_width)) {
+		minirl_state_had_error(l);
+		success = false;
+		goto done;
+	}
+
+	struct buffer * const ab = &minirl->output;
+
+	if (display_can_be_updated(minirl, new)) {
+		emit_line_update(ab, l, &minirl->shadow, new, &current_cursor);
+	} else {
+		emit_line_repaint(ab, l, new, &current_cursor, &line_end_cursor);
+	}
+	display_shadow_update(minirl, new);
 
 	l->previous_cursor = current_cursor;
 	l->previous_line_end = line_end_cursor;
@@ -588,15 +1072,7 @@ minirl_refresh_line(minirl_st * const minirl)
 	l->flags.refresh_required = false;
 	l->flags.cursor_refresh_required = false;
 
-	if (io_write(minirl->out.fd, ab.b, ab.len) == -1) {
-		success = false;
-	}
-
-	buffer_clear(&ab);
-
 done:
-	internal_line_buffer_free(&internal);
-
 	return success;
 }
 
@@ -622,6 +1098,7 @@ minirl_edit_insert(
 	}
 
 	/* Insert the new text into the line buffer. */
+	minirl_state_line_edited(l, l->pos, 0, len);
 	if (l->len != l->pos) {
 		memmove(l->line_buf->b + l->pos + len,
 			l->line_buf->b + l->pos,
@@ -633,18 +1110,33 @@ minirl_edit_insert(
 	l->line_buf->b[l->len] = '\0';
 
 	bool require_full_refresh = true;
+	char const *visible_text = NULL;
+	size_t visible_len = 0;
 
-	if (l->len == l->pos) { /* Editing at the end of the line. */
+	/*
+	 * Text added at the end of the line can be written straight to the
+	 * terminal, but only if the display is up to date. If a refresh has
+	 * been deferred the terminal cursor may not be at the line end.
+	 */
+	if (l->len == l->pos && !minirl_state_refresh_pending(l) && l->shadow_valid) {
 		cursor_st const old_line_end = l->previous_cursor;
 		cursor_st new_line_end;
 		internal_line_buffer_st internal;
 
-		if (!internal_line_buffer_init(&internal, l, &minirl->options.echo)) {
+		calculate_cursor_position(minirl, &new_line_end, l->len);
+
+		if (!internal_line_buffer_init(&internal, minirl)) {
 			minirl_state_had_error(l);
 			return false;
 		}
 
-		calculate_cursor_position(l, &new_line_end, internal.end, &internal);
+		/*
+		 * The line previously displayed is a prefix of the new one, so
+		 * only what follows it needs to be written.
+		 */
+		struct display * const shadow = &minirl->shadow;
+		size_t const displayed = shadow->text.len - shadow->prompt_len;
+
 		/*
 		 * As long as the cursor remains on the same row as before the
 		 * current character was added, and hasn't filled the terminal
@@ -653,41 +1145,109 @@ minirl_edit_insert(
 		 * then the line still doesn't need to be refreshed as the
 		 * terminal will update the cursor automatically.
 		 */
-		if (new_line_end.row == old_line_end.row
-			|| (new_line_end.col == 0 && l->line_buf->b[l->len - 1] == '\n')) {
+		if (displayed <= internal.end
+		    && (new_line_end.row == old_line_end.row
+			|| (new_line_end.col == 0 && l->line_buf->b[l->len - 1] == '\n'))) {
 
 			require_full_refresh = false;
 			/*
-			 * After the io_write() is done the saved cursor positions
+			 * After the text is written the saved cursor positions
 			 * will become  out of date, so update the saved cursor
 			 * positions to reflect where the current cursor position
-			 * is after the io_write.
+			 * is after the write.
 			 */
 			l->previous_cursor = new_line_end;
 			l->previous_line_end = new_line_end;
 			if (l->max_rows < (new_line_end.row + 1)) {
 				l->max_rows = new_line_end.row + 1;
 			}
-		}
 
-		internal_line_buffer_free(&internal);
+			visible_text = internal.buffer + displayed;
+			visible_len = internal.end - displayed;
+
+			/* Keep the record of what is displayed up to date. */
+			if (!display_append(shadow, visible_text, visible_len)) {
+				l->shadow_valid = false;
+			}
+		}
 	}
 
 	if (require_full_refresh) {
 		minirl_state_refresh_required(l);
-	} else if (!minirl->options.echo.disable) {
-		if (io_write(minirl->out.fd, text, len) == -1) {
+	} else if (visible_len > 0) {
+		if (!output_append(minirl, visible_text, visible_len)) {
 			minirl_state_had_error(l);
 			return false;
 		}
-	} else if (minirl->options.echo.ch != '\0') {
-		if (io_write(minirl->out.fd,
-			     &minirl->options.echo.ch,
-			     sizeof minirl->options.echo.ch) == -1) {
+	}
+
+	return true;
+}
+
+/* Replace the whole of the line with 'text'. */
+static bool
+minirl_line_replace(minirl_state_st * const l, char const * const text, size_t const len)
+{
+	if (len >= l->line_buf->capacity
+	    && !buffer_grow(l->line_buf, len - l->line_buf->capacity)) {
+		minirl_state_had_error(l);
+		return false;
+	}
+	minirl_state_line_changed(l, 0);
+	if (len > 0) {
+		memcpy(l->line_buf->b, text, len);
+	}
+	l->line_buf->b[len] = '\0';
+	l->line_buf->len = len;
+	l->len = l->pos = len;
+
+	return true;
+}
+
+/*
+ * Keep any changes made to the current line before it is replaced with a
+ * different history entry. Index 0 is the line being entered, which isn't
+ * part of the history.
+ */
+static bool
+history_line_keep(minirl_st * const minirl)
+{
+	minirl_state_st * const l = &minirl->state;
+	size_t const index = l->history_index;
+
+	if (index == 0) {
+		buffer_reset(&minirl->history_scratch);
+		if (!buffer_append(&minirl->history_scratch, l->line_buf->b, l->len)) {
 			minirl_state_had_error(l);
 			return false;
 		}
+	} else if (!history_replace(&minirl->history, index - 1, l->line_buf->b, l->len)) {
+		minirl_state_had_error(l);
+		return false;
+	}
+
+	return true;
+}
+
+/* Show the history entry at 'index' in place of the current line. */
+static bool
+history_line_show(minirl_st * const minirl, size_t const index)
+{
+	minirl_state_st * const l = &minirl->state;
+	char const *text = minirl->history_scratch.b;
+	size_t len = minirl->history_scratch.len;
+
+	if (index > 0) {
+		struct history_entry const * const entry = history_get(&minirl->history, index - 1);
+
+		text = entry->line;
+		len = entry->len;
+	}
+
+	if (!minirl_line_replace(l, text, len)) {
+		return false;
 	}
+	l->history_index = index;
 
 	return true;
 }
@@ -706,33 +1266,198 @@ static bool
 minirl_edit_history_next(minirl_st * const minirl, enum minirl_history_direction const dir)
 {
 	minirl_state_st * const l = &minirl->state;
+	size_t const index = l->history_index;
+	bool const older = dir == minirl_HISTORY_PREV;
 
-	if (minirl->history.current_len > 1) {
-		/*
-		 * Update the current history entry before to
-		 * overwrite it with the next one.
-		 */
-		free(minirl->history.history[minirl->history.current_len - 1 - l->history_index]);
-		minirl->history.history[minirl->history.current_len - 1 - l->history_index] = strdup(l->line_buf->b);
-		/* Show the new entry */
-		l->history_index += (dir == minirl_HISTORY_PREV) ? 1 : -1;
-		if (l->history_index < 0) {
-			l->history_index = 0;
+	STATS_ADD(minirl, history_moves, 1);
+
+	/*
+	 * The text before the cursor is used as a prefix that the entries
+	 * shown must start with. While moving through the history the prefix
+	 * stays the same, as long as the line isn't changed in between.
+	 */
+	size_t const prefix_len = (l->history_prefix.valid && l->history_prefix.pos == l->pos)
+				  ? l->history_prefix.len
+				  : l->pos;
+	char const * const prefix = l->line_buf->b;
+	size_t new_index;
+
+	if (older) {
+		if (index >= minirl->history.count) {
 			return false;
-		} else if (l->history_index >= minirl->history.current_len) {
-			l->history_index = minirl->history.current_len - 1;
+		}
+		new_index = index + 1;
+	} else {
+		if (index == 0) {
 			return false;
 		}
-		buffer_clear(l->line_buf);
-		buffer_init(l->line_buf,
-			    strlen(minirl->history.history[minirl->history.current_len - 1 - l->history_index]));
-		buffer_append(l->line_buf,
-			      minirl->history.history[minirl->history.current_len - 1 - l->history_index],
-			      strlen(minirl->history.history[minirl->history.current_len - 1 - l->history_index]));
-		l->len = l->pos = l->line_buf->len;
-		return true;
+		new_index = index - 1;
 	}
-	return false;
+
+	if (prefix_len > 0) {
+		/* Skip entries that are the same as the line currently shown. */
+		for (;;) {
+			size_t age;
+
+			if (new_index == 0) {
+				break;
+			}
+			if (!history_prefix_search(&minirl->history,
+						   prefix,
+						   prefix_len,
+						   new_index - 1,
+						   !older,
+						   &age)) {
+				if (older) {
+					return false;
+				}
+				/* Return to the line being entered. */
+				new_index = 0;
+				break;
+			}
+
+			struct history_entry const * const entry = history_get(&minirl->history, age);
+
+			new_index = age + 1;
+			if (entry->len != l->len || memcmp(entry->line, l->line_buf->b, l->len) != 0) {
+				break;
+			}
+			new_index = older ? new_index + 1 : new_index - 1;
+		}
+	}
+
+	if (!history_line_keep(minirl) || !history_line_show(minirl, new_index)) {
+		return false;
+	}
+
+	l->history_prefix.valid = true;
+	l->history_prefix.len = prefix_len;
+	l->history_prefix.pos = l->pos;
+
+	return true;
+}
+
+/*
+ * Show the search query in place of the prompt while the history is being
+ * searched.
+ */
+static bool
+history_search_prompt_update(minirl_st * const minirl)
+{
+	minirl_state_st * const l = &minirl->state;
+	struct buffer const * const query = &minirl->search.query;
+	struct buffer * const ab = &minirl->search.prompt;
+	char const * const start = l->search.failed
+				   ? "(failed reverse-i-search)`"
+				   : "(reverse-i-search)`";
+
+	buffer_reset(ab);
+	if (!buffer_append(ab, start, strlen(start))
+	    || (query->len > 0 && !buffer_append(ab, query->b, query->len))
+	    || !buffer_append(ab, "': ", 3)) {
+		minirl_state_had_error(l);
+		return false;
+	}
+	l->prompt = ab->b;
+	l->prompt_len = ab->len;
+	layout_reset(l->layout);
+	minirl_state_refresh_required(l);
+
+	return true;
+}
+
+/*
+ * Show the newest history entry matching the search query that is no newer
+ * than the entry at 'from_age'. If there isn't one the line is left as it
+ * is.
+ */
+static bool
+history_search_update(minirl_st * const minirl, size_t const from_age)
+{
+	minirl_state_st * const l = &minirl->state;
+	struct buffer const * const query = &minirl->search.query;
+	size_t age;
+	size_t offset;
+
+	STATS_ADD(minirl, history_searches, 1);
+
+	l->search.failed = query->len > 0
+			   && !history_search(&minirl->history,
+					      query->b,
+					      query->len,
+					      from_age,
+					      &age,
+					      &offset);
+
+	if (query->len > 0 && !l->search.failed) {
+		if (!history_line_show(minirl, age + 1)) {
+			return false;
+		}
+		l->pos = offset;
+		l->search.age = age;
+	}
+
+	return history_search_prompt_update(minirl);
+}
+
+static bool
+history_search_start(minirl_st * const minirl)
+{
+	minirl_state_st * const l = &minirl->state;
+	struct buffer * const line = &minirl->search.line;
+
+	/* Save the line so it can be restored if the search is cancelled. */
+	buffer_reset(line);
+	if (!history_line_keep(minirl) || !buffer_append(line, l->line_buf->b, l->len)) {
+		minirl_state_had_error(l);
+		return false;
+	}
+	buffer_reset(&minirl->search.query);
+
+	l->search.active = true;
+	l->search.failed = false;
+	l->search.age = 0;
+	l->search.prompt = l->prompt;
+	l->search.prompt_len = l->prompt_len;
+	l->search.pos = l->pos;
+	l->search.history_index = l->history_index;
+
+	return history_search_prompt_update(minirl);
+}
+
+/* Finish searching, leaving the matching entry to be edited. */
+static void
+history_search_accept(minirl_st * const minirl)
+{
+	minirl_state_st * const l = &minirl->state;
+
+	l->search.active = false;
+	l->prompt = l->search.prompt;
+	l->prompt_len = l->search.prompt_len;
+	layout_reset(l->layout);
+	minirl_state_refresh_required(l);
+
+	/* Moving through the history from the match isn't limited to a prefix. */
+	l->history_prefix.valid = true;
+	l->history_prefix.len = 0;
+	l->history_prefix.pos = l->pos;
+}
+
+/* Finish searching, restoring the line as it was before the search. */
+static bool
+history_search_cancel(minirl_st * const minirl)
+{
+	minirl_state_st * const l = &minirl->state;
+	struct buffer const * const line = &minirl->search.line;
+
+	history_search_accept(minirl);
+	if (!minirl_line_replace(l, line->b, line->len)) {
+		return false;
+	}
+	l->pos = l->search.pos;
+	l->history_index = l->search.history_index;
+
+	return true;
 }
 
 static void
@@ -745,6 +1470,8 @@ delete_text(minirl_state_st * const l, size_t const start, size_t const end)
 	/* Move any text which is left, including terminator. */
 	size_t const delta = end - start;
 
+	minirl_state_line_edited(l, start, delta, 0);
+
 	memmove(&l->line_buf->b[start],
 			&l->line_buf->b[start + delta],
 			l->len + 1 - end);
@@ -827,6 +1554,7 @@ minirl_edit_delete_prev_word(minirl_state_st * const l)
 	size_t const diff = old_pos - l->pos;
 
 	if (diff != 0) {
+		minirl_state_line_edited(l, l->pos, diff, 0);
 		memmove(l->line_buf->b + l->pos,
 			l->line_buf->b + old_pos,
 			l->len - old_pos + 1);
@@ -839,6 +1567,7 @@ static bool
 delete_whole_line(minirl_state_st * const l)
 {
 	if (l->len > 0) {
+		minirl_state_line_changed(l, 0);
 		l->line_buf->b[0] = '\0';
 		l->pos = 0;
 		l->len = 0;
@@ -849,6 +1578,17 @@ delete_whole_line(minirl_state_st * const l)
 	return false;
 }
 
+static void
+bytes_reverse(char * const bytes, size_t const len)
+{
+	for (size_t i = 0, j = len; i + 1 < j; i++, j--) {
+		char const c = bytes[i];
+
+		bytes[i] = bytes[j - 1];
+		bytes[j - 1] = c;
+	}
+}
+
 static bool
 swap_chars_at_cursor(minirl_state_st * const l)
 {
@@ -857,16 +1597,12 @@ swap_chars_at_cursor(minirl_state_st * const l)
 		size_t const prev_len = l->pos - prev;
 		size_t const next = grapheme_next(l->line_buf->b, l->len, l->pos);
 		size_t const next_len = next - l->pos;
-		char * const temp_buf = malloc(prev_len + next_len);
 
-		if (temp_buf == NULL)
-		{
-			goto not_swapped;
-		}
-		memcpy(temp_buf, l->line_buf->b + l->pos, next_len);
-		memcpy(temp_buf + next_len, l->line_buf->b + prev, prev_len);
-		memcpy(l->line_buf->b + prev, temp_buf, prev_len + next_len);
-		free(temp_buf);
+		minirl_state_line_edited(l, prev, prev_len + next_len, prev_len + next_len);
+		/* Swapping the two graphemes is a rotation of their bytes. */
+		bytes_reverse(l->line_buf->b + prev, prev_len);
+		bytes_reverse(l->line_buf->b + l->pos, next_len);
+		bytes_reverse(l->line_buf->b + prev, prev_len + next_len);
 		/*
 		 * Update the edit position so that it's located just after the
 		 * character to the left.
@@ -882,7 +1618,6 @@ swap_chars_at_cursor(minirl_state_st * const l)
 		return true;
 	}
 
-not_swapped:
 	return false;
 }
 
@@ -890,6 +1625,7 @@ static bool
 delete_from_cursor_to_eol(minirl_state_st * const l)
 {
 	if (l->pos != l->len) {
+		minirl_state_line_changed(l, l->pos);
 		l->line_buf->b[l->pos] = '\0';
 		l->len = l->pos;
 
@@ -899,22 +1635,109 @@ delete_from_cursor_to_eol(minirl_state_st * const l)
 	return false;
 }
 
+/*
+ * Write the messages from minirl_async_print() above the edit line, which is
+ * cleared first if 'clear' is set. However many messages there are, the line
+ * is only redrawn once.
+ */
+static void
+async_print_process(minirl_st * const minirl, bool const clear)
+{
+	minirl_state_st * const l = &minirl->state;
+
+	if (l->completion_query) {
+		/* The messages wait until the question has been answered. */
+		return;
+	}
+
+	struct print_message * const messages = print_queue_take(&minirl->print_queue);
+
+	if (messages == NULL) {
+		return;
+	}
+
+	struct buffer * const ab = &minirl->output;
+	bool at_row_start = true;
+
+	if (clear) {
+		emit_line_clear(ab, l);
+	}
+	for (struct print_message const *m = messages; m != NULL; m = m->next) {
+		if (m->len > 0) {
+			buffer_append(ab, m->text, m->len);
+			at_row_start = m->text[m->len - 1] == '\n';
+		}
+	}
+	if (!at_row_start) {
+		buffer_append(ab, "\n", 1);
+	}
+	print_queue_messages_free(messages);
+
+	minirl_state_reset_line_state(l);
+}
+
+/* Matches delivered for a completion started by minirl_complete_async(). */
+struct completion_delivery {
+	unsigned long token;
+	bool allow_prefix;
+	char const *matches[];  /* NULL terminated, followed by the strings. */
+};
+
+/* Cancel the completion started by minirl_complete_async(), if any. */
+static void
+async_completion_cancel(minirl_st * const minirl)
+{
+	__atomic_store_n(&minirl->async_completion.token, 0, __ATOMIC_RELEASE);
+	free(__atomic_exchange_n(&minirl->async_completion.delivered, NULL, __ATOMIC_ACQ_REL));
+}
+
+/*
+ * Cancel the pending completion if the line or the editing position has
+ * changed since it was started, as its matches would no longer apply.
+ */
+static void
+async_completion_check(minirl_st * const minirl)
+{
+	minirl_state_st const * const l = &minirl->state;
+	struct buffer const * const line = &minirl->async_completion.line;
+
+	if (minirl->async_completion.token != 0
+	    && (l->pos != minirl->async_completion.pos
+		|| l->len != line->len
+		|| (l->len > 0 && memcmp(l->line_buf->b, line->b, l->len) != 0))) {
+		async_completion_cancel(minirl);
+	}
+}
+
+/* Complete the word using any matches delivered for the pending completion. */
 static void
-remove_current_line_from_history(minirl_st * const minirl)
+async_completion_process(minirl_st * const minirl)
 {
-	if (minirl->history.current_len == 0) {
-		/* Shouldn't happen. assert instead? */
+	minirl_state_st const * const l = &minirl->state;
+	struct completion_delivery * const delivered =
+		__atomic_exchange_n(&minirl->async_completion.delivered, NULL, __ATOMIC_ACQ_REL);
+
+	if (delivered == NULL) {
 		return;
 	}
-	minirl->history.current_len--;
-	free(minirl->history.history[minirl->history.current_len]);
-	minirl->history.history[minirl->history.current_len] = NULL;
+	if (delivered->token == minirl->async_completion.token
+	    && !l->search.active
+	    && !l->completion_query) {
+		__atomic_store_n(&minirl->async_completion.token, 0, __ATOMIC_RELEASE);
+
+		bool const res = minirl_complete(minirl,
+						 minirl->async_completion.start,
+						 delivered->matches,
+						 delivered->allow_prefix);
+		(void)res;
+	}
+	free(delivered);
 }
 
 static void
 minirl_edit_done(minirl_st * const minirl)
 {
-	remove_current_line_from_history(minirl);
+	async_completion_cancel(minirl);
 	move_edit_position_to_end(&minirl->state);
 	if (minirl->state.flags.cursor_refresh_required) {
 		minirl_refresh_cursor(minirl);
@@ -925,7 +1748,7 @@ minirl_edit_done(minirl_st * const minirl)
 	 * of the line) to the next line.
 	 */
 	char const nl = '\n';
-	int const res = io_write(minirl->out.fd, &nl, sizeof nl);
+	bool const res = output_append(minirl, &nl, sizeof nl);
 	(void)res;
 }
 
@@ -1060,7 +1883,6 @@ ctrl_d_handler(minirl_st * const minirl, char const *key, void * const user_ctx)
 		result = delete_handler(minirl, key, user_ctx);
 	} else {
 		/* Line is empty, so indicate an error. */
-		remove_current_line_from_history(minirl);
 		minirl_state_had_error(l);
 		result = true;
 	}
@@ -1128,42 +1950,190 @@ ctrl_w_handler(minirl_st * const minirl, char const *key, void * const user_ctx)
 	return true;
 }
 
-typedef struct char_st {
-	int len;
-	char bytes[MAX_CHAR_LEN + 1];
-} char_st;
-
-static char_st
-char_read(int const fd)
+static bool
+reverse_search_handler(minirl_st * const minirl, char const *key, void * const user_ctx)
 {
 	/*
-	 * Read either an ASCII or UTF-8 char from the input stream, depending on
-	 * whether UTF-8 support is included.
+	 * Search backwards through the history for the text typed after this
+	 * key. Pressing it again finds the next older match.
 	 */
-	char_st ch = { 0 };
-	int nread;
+	minirl_state_st * const l = &minirl->state;
 
-	nread = io_read(fd, &ch.bytes[0], sizeof(ch.bytes[ch.len]));
-	if (nread == EOF) {
-		ch.len = -1;
-		goto done;
+	if (!l->search.active) {
+		history_search_start(minirl);
+	} else if (minirl->search.query.len > 0 && !l->search.failed) {
+		history_search_update(minirl, l->search.age + 1);
 	}
 
-	ch.len = char_len(ch.bytes[0]);
-	if (ch.len == 0 || ch.len > MAX_CHAR_LEN) {
-		ch.len = -1;
-		goto done;
-	}
+	return true;
+}
 
-	/* Read the rest of the bytes making up this char (will be 0 for ASCII). */
-	for (int i = 1; i < ch.len; i++) {
-		nread = io_read(fd, &ch.bytes[i], 1);
-		if (nread == EOF) {
+static bool
+abort_handler(minirl_st * const minirl, char const *key, void * const user_ctx)
+{
+	/* Cancel a history search. */
+	if (minirl->state.search.active) {
+		history_search_cancel(minirl);
+	}
+
+	return true;
+}
+
+/*
+ * Handle a key while the history is being searched. Text is added to the
+ * search query, and most other keys end the search, leaving the matching
+ * entry to be edited, before being handled as usual.
+ * Return true if the key has been used by the search.
+ */
+static bool
+history_search_key(
+	minirl_st * const minirl,
+	minirl_key_binding_handler_cb const handler,
+	char const * const key)
+{
+	minirl_state_st * const l = &minirl->state;
+	struct buffer * const query = &minirl->search.query;
+
+	if (handler == default_handler) {
+		if (!buffer_append(query, key, strlen(key))) {
+			minirl_state_had_error(l);
+		} else {
+			history_search_update(minirl, l->search.age);
+		}
+
+		return true;
+	}
+
+	if (handler == backspace_handler) {
+		if (query->len > 0) {
+			query->len = char_prev(query->b, query->len, query->len);
+			query->b[query->len] = '\0';
+			history_search_update(minirl, 0);
+		}
+
+		return true;
+	}
+
+	if (handler != reverse_search_handler && handler != abort_handler) {
+		history_search_accept(minirl);
+	}
+
+	return false;
+}
+
+static bool
+paste_start_handler(minirl_st * const minirl, char const *key, void * const user_ctx)
+{
+	/* Everything up to the paste end marker is inserted literally. */
+	minirl->state.in_paste = true;
+
+	return true;
+}
+
+static bool
+paste_end_handler(minirl_st * const minirl, char const *key, void * const user_ctx)
+{
+	minirl->state.in_paste = false;
+
+	return true;
+}
+
+/*
+ * Read more input into the input buffer, as input_buffer_fill() does.
+ * The input is recorded if a recording is being made, and when replaying a
+ * recording the line is redrawn if the recorded terminal width changed.
+ */
+static int
+input_fill(minirl_st * const minirl, bool const wait)
+{
+	struct input_buffer * const ib = &minirl->input;
+	size_t offset = input_buffer_pending(ib);
+	int const nread = input_buffer_fill(ib, minirl->io, minirl->io_ctx, wait);
+
+	if (nread > 0 && recorder_active(&minirl->recorder)) {
+		size_t left = nread;
+
+		/* The input may wrap around the end of the buffer. */
+		while (left > 0) {
+			size_t len;
+			char const * const span = input_buffer_span(ib, offset, &len);
+
+			if (len > left) {
+				len = left;
+			}
+			recorder_input(&minirl->recorder, span, len);
+			offset += len;
+			left -= len;
+		}
+	}
+	if (minirl->io == &replay_io && replay_resized(&minirl->replay)) {
+		minirl_state_refresh_required(&minirl->state);
+	}
+
+	return nread;
+}
+
+/*
+ * Return the next input byte, reading more input if the buffer is empty.
+ * Returns -1 on EOF or error.
+ */
+static int
+input_getc(minirl_st * const minirl)
+{
+	struct input_buffer * const ib = &minirl->input;
+
+	if (input_buffer_pending(ib) == 0 && input_fill(minirl, true) <= 0) {
+		return -1;
+	}
+
+	uint8_t const c = input_buffer_peek(ib, 0);
+
+	input_buffer_consume(ib, 1);
+
+	return c;
+}
+
+typedef struct char_st {
+	int len;
+	char bytes[MAX_CHAR_LEN + 1];
+} char_st;
+
+static char_st
+char_read(minirl_st * const minirl)
+{
+	/*
+	 * Read either an ASCII or UTF-8 char from the input stream, depending on
+	 * whether UTF-8 support is included.
+	 * Bytes are taken from the input buffer, which is only refilled from the
+	 * input stream once everything read previously has been consumed.
+	 */
+	char_st ch = { 0 };
+	int c;
+
+	c = input_getc(minirl);
+	if (c < 0) {
+		ch.len = -1;
+		goto done;
+	}
+	ch.bytes[0] = c;
+
+	size_t const len = char_len(ch.bytes[0]);
+	if (len == 0 || len > MAX_CHAR_LEN) {
+		ch.len = -1;
+		goto done;
+	}
+	ch.len = len;
+
+	/* Read the rest of the bytes making up this char (will be 0 for ASCII). */
+	for (size_t i = 1; i < len; i++) {
+		c = input_getc(minirl);
+		if (c < 0) {
 			ch.len = -1;
 			goto done;
 		}
+		ch.bytes[i] = c;
 	}
-	ch.bytes[ch.len] = '\0';
+	ch.bytes[len] = '\0';
 
 	bool const is_valid_char = char_decode(ch.bytes, ch.len, NULL) == ch.len;
 	if (!is_valid_char) {
@@ -1175,6 +2145,129 @@ done:
 	return ch;
 }
 
+static bool
+is_plain_text_key(minirl_keymap_st const * const keymap, uint8_t const key)
+{
+	/*
+	 * A key is plain text if it would be handed straight to the default
+	 * handler by key_handler_lookup(). Bytes that start a bound sequence
+	 * have their own keymap and must be looked up.
+	 */
+	key_handler_st const * const entry = minirl_keymap_lookup(keymap, key);
+
+	return entry != NULL
+		&& entry->handler == default_handler
+		&& entry->keymap == NULL;
+}
+
+/*
+ * Copy the run of plain text chars at the head of the input buffer into
+ * 'text' so that it can be inserted into the line in one go.
+ * While a bracketed paste is in progress everything up to the next escape
+ * is treated as text, with CRs converted to newlines and any other control
+ * characters discarded.
+ * Returns the number of bytes copied, which is 0 if the next input isn't
+ * plain text and needs to go through key_handler_lookup().
+ * Nothing is copied while asking whether to list the completions, as only
+ * the next key answers the question and the rest is to be edited as usual.
+ */
+static size_t
+text_run_read(minirl_st * const minirl, char * const text, size_t const text_size)
+{
+	struct input_buffer * const ib = &minirl->input;
+	bool const in_paste = minirl->state.in_paste;
+	size_t pending = input_buffer_pending(ib);
+	size_t offset = 0;
+	size_t len = 0;
+
+	if (minirl->state.completion_query) {
+		return 0;
+	}
+
+	while (offset < pending) {
+		/*
+		 * Runs of printable ASCII need no decoding or validation, so
+		 * are copied straight out of the input buffer.
+		 */
+		size_t span_len;
+		char const * const span = input_buffer_span(ib, offset, &span_len);
+		size_t run = ascii_printable_run(span, span_len);
+
+		if (run > text_size - 1 - len) {
+			run = text_size - 1 - len;
+		}
+		if (!in_paste) {
+			/* Stop at any char that is bound to a handler of its own. */
+			size_t plain = 0;
+
+			while (plain < run && is_plain_text_key(minirl->keymap, span[plain])) {
+				plain++;
+			}
+			run = plain;
+		}
+		if (run > 0) {
+			memcpy(&text[len], span, run);
+			offset += run;
+			len += run;
+			continue;
+		}
+
+		uint8_t const c = input_buffer_peek(ib, offset);
+
+		if (in_paste && c == ESC) {
+			break;
+		}
+		if (in_paste && c == ENTER && offset + 1 == pending) {
+			/* See whether a '\n' follows, as the pair is one newline. */
+			if (len > 0) {
+				break;
+			}
+			if (input_fill(minirl, true) > 0) {
+				pending = input_buffer_pending(ib);
+				continue;
+			}
+		}
+		if (!in_paste && !is_plain_text_key(minirl->keymap, c)) {
+			break;
+		}
+
+		size_t const ch_len = char_len(c);
+
+		if (ch_len == 0
+		    || offset + ch_len > pending
+		    || len + ch_len >= text_size) {
+			break;
+		}
+		if (in_paste && ch_len == 1 && (c < ' ' || c == BACKSPACE)) {
+			offset++;
+			if (c == '\r' && offset < pending && input_buffer_peek(ib, offset) == '\n') {
+				offset++;
+			}
+			if (c == '\r' || c == '\n') {
+				text[len++] = '\n';
+			} else if (c == TAB) {
+				text[len++] = ' ';
+			}
+			continue;
+		}
+
+		for (size_t i = 0; i < ch_len; i++) {
+			text[len + i] = input_buffer_peek(ib, offset + i);
+		}
+		if (char_decode(&text[len], ch_len, NULL) != ch_len) {
+			/* Let char_read() deal with the invalid char. */
+			break;
+		}
+		offset += ch_len;
+		len += ch_len;
+	}
+
+	input_buffer_consume(ib, offset);
+	text[len] = '\0';
+
+	return len;
+}
+
 static void
 key_handler_lookup(
 	minirl_st * const minirl,
@@ -1186,22 +2279,25 @@ key_handler_lookup(
 	 * Look through the key map sequence until a match is found, or
 	 * there is no keymap assigned to the current key.
 	 */
-	minirl_keymap_st *keymap = minirl->keymap;
+	minirl_keymap_st const *keymap = minirl->keymap;
 
 	for (int i = 0; i < ch->len;) {
-		uint8_t const index = ch->bytes[i];
+		key_handler_st const * const entry = minirl_keymap_lookup(keymap, ch->bytes[i]);
 
-		if (keymap->keys[index].handler != NULL) {
+		if (entry == NULL) {
+			break;
+		}
+		if (entry->handler != NULL) {
 			/*
 			 * For unbound UTF-8 chars the first
 			 * byte will assign the default handler. If there is a handler
 			 * assigned to a specific UTF-8 char then a handler will be
 			 * found at the last byte in the sequence.
 			 */
-			*handler = keymap->keys[index].handler;
-			*user_ctx = keymap->keys[index].user_ctx;
+			*handler = entry->handler;
+			*user_ctx = entry->user_ctx;
 		}
-		keymap = keymap->keys[index].keymap;
+		keymap = entry->keymap;
 		if (keymap == NULL) {
 			break;
 		}
@@ -1209,7 +2305,7 @@ key_handler_lookup(
 		i++;
 		if (i >= ch->len) {
 			/* Get here with multi-byte sequences. */
-			char_st new_ch = char_read(minirl->in.fd);
+			char_st new_ch = char_read(minirl);
 
 			if (new_ch.len <= 0) {
 				break;
@@ -1221,527 +2317,1621 @@ key_handler_lookup(
 }
 
 /*
- * This function is the core of the line editing capability of minirl.
- * It expects 'fd' to be already in "raw mode" so that every key pressed
- * will be returned ASAP to read().
- *
- * The function returns the length of the current buffer, or -1 if and error
- * occurred.
+ * Determine whether the input buffer holds the whole of the next key, by
+ * following the keymap through it as key_handler_lookup() would. If not,
+ * processing the key would have to wait for more input.
  */
-static int minirl_edit(
-	minirl_st * const minirl,
-	struct buffer * const line_buf,
-	char const * const prompt)
+static bool
+input_key_is_complete(minirl_st * const minirl)
 {
-	memset(&minirl->state, 0, sizeof minirl->state);
-
-	minirl_state_st * const l = &minirl->state;
-
-	/* Populate the minirl state implementing editing functionalities. */
-	l->line_buf = line_buf;
-	l->prompt = prompt;
-	l->prompt_len = strlen(prompt);
-	l->pos = 0;
-	l->len = 0;
-	l->terminal_width = minirl_terminal_width(minirl);
-	l->max_rows = 1;
-	l->history_index = 0;
+	struct input_buffer const * const ib = &minirl->input;
+	size_t const pending = input_buffer_pending(ib);
+	minirl_keymap_st const *keymap = minirl->keymap;
+	size_t offset = 0;
 
-	/* Buffer starts empty. */
-	l->line_buf->b[0] = '\0';
-
-	/*
-	 * The line buffer is empty so there's no need to pass an internal
-	 * representation of it.
-	 */
-	calculate_cursor_position(l, &l->previous_cursor, 0, NULL);
-	l->previous_line_end = l->previous_cursor;
+	if (minirl->state.in_paste && pending == 1 && input_buffer_peek(ib, 0) == ENTER) {
+		/* A pasted '\r' waits to see whether a '\n' follows. */
+		return false;
+	}
 
-	/*
-	 * The latest history entry is always our current buffer, that
-	 * initially is just an empty string.
-	 */
-	minirl_history_add(minirl, "");
+	for (;;) {
+		if (offset >= pending) {
+			return false;
+		}
 
-	/* Get the prompt printed by refreshing the empty line. */
-	minirl_refresh_line(minirl);
+		size_t const len = char_len(input_buffer_peek(ib, offset));
 
-	for (;;) {
-		char_st ch = char_read(minirl->in.fd);
+		if (len == 0 || len > MAX_CHAR_LEN) {
+			/* char_read() rejects this without reading any more. */
+			return true;
+		}
+		if (offset + len > pending) {
+			return false;
+		}
+		for (size_t i = 0; i < len; i++) {
+			key_handler_st const * const entry =
+				minirl_keymap_lookup(keymap, input_buffer_peek(ib, offset + i));
 
-		if (ch.len <= 0) {
-			return -1;
+			if (entry == NULL || entry->keymap == NULL) {
+				return true;
+			}
+			keymap = entry->keymap;
 		}
+		offset += len;
+	}
+}
 
-		minirl_key_binding_handler_cb handler = NULL;
-		void *user_ctx = NULL;
+static uint64_t
+monotonic_ns(void)
+{
+	struct timespec ts;
 
-		key_handler_lookup(minirl, &ch, &handler, &user_ctx);
+	clock_gettime(CLOCK_MONOTONIC, &ts);
 
-		if (handler != NULL) {
-			l->flags = (minirl_key_handler_flags_st){0};
+	return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
 
-			/* TODO: Should pass the complete key sequence. */
-			bool const res = handler(minirl, ch.bytes, user_ctx);
-			(void)res; //* TODO: Treat false as an error?
+static uint64_t
+monotonic_ms(void)
+{
+	struct timespec ts;
 
-			if (l->flags.error) {
-				return -1;
-			}
+	clock_gettime(CLOCK_MONOTONIC, &ts);
 
-			if (!l->flags.done
-			    && !l->flags.refresh_required
-			    && l->flags.cursor_refresh_required) {
-				minirl_refresh_cursor(minirl);
-			}
-			if (l->flags.refresh_required) {
-				minirl_refresh_line(minirl);
-			}
+	return (uint64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
 
-			if (l->flags.done) {
-				minirl_edit_done(minirl);
-				break;
-			}
-		}
-	}
+/*
+ * Bring the display up to date with any changes made by key handlers.
+ * A full refresh also takes care of any cursor movement, so at most
+ * one of the two is written.
+ */
+static void
+minirl_refresh_pending(minirl_st * const minirl)
+{
+	minirl_state_st * const l = &minirl->state;
 
-	return l->len;
+	if (l->completion_query) {
+		/* The line is redrawn once the question has been answered. */
+		return;
+	}
+	if (!l->flags.refresh_required && l->flags.cursor_refresh_required) {
+		/* This may find that a full refresh is needed after all. */
+		minirl_refresh_cursor(minirl);
+	}
+	if (l->flags.refresh_required) {
+		minirl_refresh_line(minirl);
+	}
+	l->dirty_since_ms = 0;
 }
 
 /*
- * This function calls the line editing function minirlEdit() using
- * the in_fd file descriptor set in raw mode.
+ * Decide whether a pending refresh should be written now. Refreshing is
+ * deferred while more input is already waiting to be processed (e.g. key
+ * auto-repeat over a slow link), so that a burst of keys results in a single
+ * update, but only for as long as the refresh budget allows.
  */
-static int
-minirl_raw(
-	minirl_st * const minirl,
-	struct buffer * const line_buf,
-	char const * const prompt)
+static bool
+minirl_refresh_is_due(minirl_st * const minirl)
 {
-	if (enable_raw_mode(minirl, minirl->in.fd) == -1) {
-		return -1;
+	minirl_state_st * const l = &minirl->state;
+	struct input_buffer * const ib = &minirl->input;
+
+	if (!minirl_state_refresh_pending(l)) {
+		return false;
+	}
+	if (minirl->options.refresh_budget_ms == 0) {
+		return true;
+	}
+	if (input_buffer_pending(ib) == 0
+	    && (minirl->nonblocking.active
+		|| input_fill(minirl, false) <= 0)) {
+		/*
+		 * The input has been drained. Fed input is never read
+		 * ahead, as it may not come from the input stream.
+		 */
+		return true;
 	}
 
-	int const count = minirl_edit(minirl, line_buf, prompt);
+	uint64_t const now = monotonic_ms();
 
-	disable_raw_mode(minirl, minirl->in.fd);
+	if (l->dirty_since_ms == 0) {
+		l->dirty_since_ms = now;
+	}
 
-	return count;
+	return now - l->dirty_since_ms >= minirl->options.refresh_budget_ms;
 }
 
-/* This function is called when minirl() is called with the standard
- * input file descriptor not attached to a TTY. So for example when the
- * program using minirl is called in pipe or with a file redirected
- * to its standard input. In this case, we want to be able to return the
- * line regardless of its length (by default we are limited to 4k). */
-static char *
-minirl_no_tty(minirl_st * const minirl)
+/*
+ * Redraw the line in full if the terminal width has changed since the line
+ * was last refreshed.
+ */
+static void
+minirl_resize_handle(minirl_st * const minirl)
 {
-	char *line = NULL;
-	size_t len = 0;
-	size_t maxlen = 0;
+	minirl_state_st * const l = &minirl->state;
+
+	if (minirl_terminal_width(minirl) != l->terminal_width) {
+		minirl_state_refresh_required(l);
+		minirl_refresh_pending(minirl);
+	}
+}
+
+/*
+ * Wait until there is some input to process, handling any terminal resize
+ * that happens in the meantime.
+ * Return false on EOF or error.
+ */
+static bool
+minirl_input_wait(minirl_st * const minirl)
+{
+	minirl_state_st const * const l = &minirl->state;
+	struct input_buffer * const ib = &minirl->input;
+
+	while (input_buffer_pending(ib) == 0) {
+		async_print_process(minirl, true);
+		async_completion_process(minirl);
+		if (minirl_state_refresh_pending(l)) {
+			minirl_refresh_pending(minirl);
+		}
+		output_flush(minirl);
 
-	while (1) {
 		/*
-		 * Grow the buffer.
-		 * XXX - Use append buffer?
+		 * Only a file descriptor can be polled along with the fds that
+		 * signal a resize, delivered completions or messages to print.
 		 */
-		if (len == maxlen) {
-			if (maxlen == 0) {
-				maxlen = 16;
-			}
-			maxlen *= 2;
-			char * const oldval = line;
-			line = realloc(line, maxlen + 1);
-			if (line == NULL) {
-				if (oldval != NULL) {
-					free(oldval);
-				}
-				return line;
-			}
-			line[len] = '\0';
+		if (minirl->in.fd < 0) {
+			return input_fill(minirl, true) > 0;
 		}
 
-		int c = fgetc(minirl->in.stream);
-		if (c == EOF || c == '\n') {
-			if (c == EOF && len == 0) {
-				free(line);
-				line = NULL;
-			}
-			return line;
-		} else {
-			line[len] = c;
-			len++;
-			line[len] = '\0';
+		/*
+		 * Other threads may print messages at any time. Without the
+		 * fd they would wait for the next key.
+		 */
+		bool const res = wakeup_open(&minirl->wakeup);
+		(void)res;
+
+		bool const poll_resize = minirl->options.track_resize;
+		int const wakeup = wakeup_fd(&minirl->wakeup);
+
+		struct pollfd fds[] = {
+			{ .fd = minirl->in.fd, .events = POLLIN },
+			{ .fd = poll_resize ? winch_pipe[0] : -1, .events = POLLIN },
+			{ .fd = wakeup, .events = POLLIN }
+		};
+
+		if (TEMP_FAILURE_RETRY(poll(fds, ARRAY_SIZE(fds), -1)) < 0) {
+			return false;
+		}
+		if ((fds[1].revents & POLLIN) != 0) {
+			winch_pipe_drain();
+			minirl_resize_handle(minirl);
+		}
+		if ((fds[2].revents & POLLIN) != 0) {
+			wakeup_drain(&minirl->wakeup);
+		}
+		if (fds[0].revents != 0
+		    && input_fill(minirl, true) < 0) {
+			return false;
 		}
 	}
-	/* Unreachable */
-	return NULL;
+
+	return true;
 }
 
-/* The high level function that is the main API of the minirl library.
- * This function checks if the terminal has basic capabilities, just checking
- * for a blacklist of stupid terminals, and later either calls the line
- * editing function or uses dummy fgets() so that you will be able to type
- * something even in the most desperate of the conditions. */
-char *
-minirl_readline(minirl_st * const minirl, char const * const prompt)
+/*
+ * Start editing a new line, printing the prompt.
+ */
+static void
+minirl_edit_start(
+	minirl_st * const minirl,
+	struct buffer * const line_buf,
+	char const * const prompt)
+{
+	memset(&minirl->state, 0, sizeof minirl->state);
+	async_completion_cancel(minirl);
+
+	minirl_state_st * const l = &minirl->state;
+
+	/* Populate the minirl state implementing editing functionalities. */
+	l->line_buf = line_buf;
+	l->layout = &minirl->layout;
+	l->prompt = prompt;
+	l->prompt_len = strlen(prompt);
+	l->pos = 0;
+	l->len = 0;
+	l->terminal_width = minirl_terminal_width(minirl);
+	l->max_rows = 1;
+	l->history_index = 0;
+
+	/* Buffer starts empty. */
+	l->line_buf->b[0] = '\0';
+	layout_reset(l->layout);
+
+	calculate_cursor_position(minirl, &l->previous_cursor, 0);
+	l->previous_line_end = l->previous_cursor;
+
+	/* Messages printed while no line was being edited go above the prompt. */
+	async_print_process(minirl, false);
+
+	/* Get the prompt printed by refreshing the empty line. */
+	minirl_refresh_line(minirl);
+}
+
+/*
+ * Answer the question of whether to display all of the completions, after
+ * which the edit line is redrawn below them.
+ */
+static void
+completion_query_answer(minirl_st * const minirl, char const * const key)
+{
+	minirl_state_st * const l = &minirl->state;
+	struct buffer * const listing = &minirl->completion.listing;
+
+	if (key[0] == 'y' || key[0] == 'Y' || key[0] == ' ') {
+		output_append(minirl, listing->b, listing->len);
+	} else {
+		output_append(minirl, "\r\n", 2);
+	}
+	buffer_clear(listing);
+	l->completion_query = false;
+	minirl_state_reset_line_state(l);
+}
+
+/*
+ * Pass a key to its handler, then refresh the line if it is time to.
+ * Returns MINIRL_STATUS_LINE once the line is complete, or
+ * MINIRL_STATUS_ERROR on error.
+ */
+static enum minirl_status
+key_dispatch(
+	minirl_st * const minirl,
+	minirl_key_binding_handler_cb const handler,
+	char const * const key,
+	void * const user_ctx)
+{
+	minirl_state_st * const l = &minirl->state;
+
+	l->flags.done = false;
+	l->in_key_handler = true;
+
+	/* TODO: Should pass the complete key sequence. */
+	bool const res = handler(minirl, key, user_ctx);
+	(void)res; //* TODO: Treat false as an error?
+
+	l->in_key_handler = false;
+	async_completion_check(minirl);
+
+	if (l->flags.error) {
+		return MINIRL_STATUS_ERROR;
+	}
+
+	if (l->flags.done) {
+		minirl_refresh_pending(minirl);
+		minirl_edit_done(minirl);
+
+		return MINIRL_STATUS_LINE;
+	}
+
+	if (minirl_refresh_is_due(minirl)) {
+		minirl_refresh_pending(minirl);
+		/* Input may still be waiting, so don't wait for it to be drained. */
+		output_flush(minirl);
+	}
+
+	return MINIRL_STATUS_PENDING;
+}
+
+/* Record how long a key took to handle, in the stats and the trace. */
+static void
+key_time_record(
+	minirl_st * const minirl,
+	char const * const key,
+	minirl_key_binding_handler_cb const handler,
+	uint64_t const elapsed_ns)
+{
+	if (minirl->stats.enabled) {
+		uint64_t const us = elapsed_ns / 1000;
+		size_t bucket = (us < 2) ? 0 : 63 - __builtin_clzll(us);
+
+		if (bucket >= MINIRL_STATS_LATENCY_BUCKETS) {
+			bucket = MINIRL_STATS_LATENCY_BUCKETS - 1;
+		}
+		minirl->stats.counts.keys++;
+		minirl->stats.counts.key_latency[bucket]++;
+	}
+	TRACE_KEY(minirl, key, handler, elapsed_ns);
+}
+
+/*
+ * Read the next key from the input and pass it to its handler.
+ * More input is read if the input buffer doesn't hold all of the key.
+ * Returns MINIRL_STATUS_LINE once the line is complete, or
+ * MINIRL_STATUS_ERROR on EOF or error.
+ */
+static enum minirl_status
+minirl_key_process(minirl_st * const minirl)
+{
+	minirl_state_st * const l = &minirl->state;
+	char text[INPUT_BUFFER_SIZE + 1];
+	minirl_key_binding_handler_cb handler = NULL;
+	void *user_ctx = NULL;
+	char const *key;
+	char_st ch;
+
+	/*
+	 * Runs of plain text (typically pasted) skip the keymap lookup
+	 * and are inserted with a single call to the default handler,
+	 * so the line is only refreshed once for the whole run.
+	 */
+	if (text_run_read(minirl, text, sizeof text) > 0) {
+		handler = default_handler;
+		key = text;
+	} else {
+		ch = char_read(minirl);
+
+		if (ch.len <= 0) {
+			return MINIRL_STATUS_ERROR;
+		}
+
+		key_handler_lookup(minirl, &ch, &handler, &user_ctx);
+		key = ch.bytes;
+	}
+
+	if (l->completion_query) {
+		/* The key answers the question. */
+		completion_query_answer(minirl, key);
+		handler = null_handler;
+	} else if (l->search.active && history_search_key(minirl, handler, key)) {
+		/* The key has been used by the search. */
+		handler = null_handler;
+	}
+
+	if (handler == NULL) {
+		return MINIRL_STATUS_PENDING;
+	}
+	if (!minirl->stats.enabled && !TRACE_KEY_WANTED(minirl)) {
+		return key_dispatch(minirl, handler, key, user_ctx);
+	}
+
+	uint64_t const start = monotonic_ns();
+	uint64_t const grows = buffer_grow_count();
+	enum minirl_status const status = key_dispatch(minirl, handler, key, user_ctx);
+
+	STATS_ADD(minirl, buffer_grows, buffer_grow_count() - grows);
+	key_time_record(minirl, key, handler, monotonic_ns() - start);
+
+	return status;
+}
+
+/*
+ * This function is the core of the line editing capability of minirl.
+ * It expects 'fd' to be already in "raw mode" so that every key pressed
+ * will be returned ASAP to read().
+ *
+ * The function returns the length of the current buffer, or -1 if and error
+ * occurred.
+ */
+static int minirl_edit(
+	minirl_st * const minirl,
+	struct buffer * const line_buf,
+	char const * const prompt)
+{
+	minirl_edit_start(minirl, line_buf, prompt);
+
+	for (;;) {
+		if (!minirl_input_wait(minirl)) {
+			return -1;
+		}
+
+		enum minirl_status const status = minirl_key_process(minirl);
+
+		if (status == MINIRL_STATUS_ERROR) {
+			return -1;
+		}
+		if (status == MINIRL_STATUS_LINE) {
+			break;
+		}
+	}
+
+	return minirl->state.len;
+}
+
+static void
+write_string(minirl_st * const minirl, char const * const s)
+{
+	bool const res = output_append(minirl, s, strlen(s));
+	(void)res;
+}
+
+/* Put the terminal into the mode used while editing a line. */
+static int
+minirl_terminal_enter(minirl_st * const minirl)
+{
+	if (enable_raw_mode(minirl, minirl->in.fd) == -1) {
+		return -1;
+	}
+	if (minirl->options.bracketed_paste) {
+		write_string(minirl, BRACKETED_PASTE_ENABLE);
+	}
+
+	return 0;
+}
+
+static void
+minirl_terminal_leave(minirl_st * const minirl)
+{
+	if (minirl->options.bracketed_paste) {
+		write_string(minirl, BRACKETED_PASTE_DISABLE);
+	}
+	/* Everything written while editing goes out in the editing mode. */
+	output_flush(minirl);
+	disable_raw_mode(minirl, minirl->in.fd);
+}
+
+/*
+ * This function calls the line editing function minirlEdit() using
+ * the in_fd file descriptor set in raw mode.
+ */
+static int
+minirl_raw(
+	minirl_st * const minirl,
+	struct buffer * const line_buf,
+	char const * const prompt)
+{
+	if (minirl_terminal_enter(minirl) == -1) {
+		return -1;
+	}
+
+	int const count = minirl_edit(minirl, line_buf, prompt);
+
+	minirl_terminal_leave(minirl);
+
+	return count;
+}
+
+/*
+ * Read the next line when the input isn't a terminal, so for example when
+ * the program using minirl is run in a pipe or with a file redirected to its
+ * standard input. There is no limit to the length of the line.
+ * The input is read in large blocks and scanned for the end of the line, so
+ * the line is returned in place in the block, and any input following it is
+ * kept for the next call.
+ * Returns NULL on EOF or error.
+ */
+static char *
+no_tty_line_read(minirl_st * const minirl, size_t * const len)
+{
+	struct buffer * const input = &minirl->no_tty.input;
+	size_t start = minirl->no_tty.next;
+	size_t scanned = start;
+
+	/* Input already read into the input buffer comes first. */
+	struct input_buffer * const ib = &minirl->input;
+
+	while (input_buffer_pending(ib) > 0) {
+		char const c = input_buffer_peek(ib, 0);
+
+		if (!buffer_append(input, &c, 1)) {
+			return NULL;
+		}
+		input_buffer_consume(ib, 1);
+	}
+
+	for (;;) {
+		char * const nl = (input->len > scanned)
+			? memchr(input->b + scanned, '\n', input->len - scanned)
+			: NULL;
+
+		if (nl != NULL) {
+			*nl = '\0';
+			minirl->no_tty.next = nl + 1 - input->b;
+			*len = nl - (input->b + start);
+
+			return input->b + start;
+		}
+		scanned = input->len;
+
+		/* Make room for more by moving the partial line to the start. */
+		if (start > 0) {
+			memmove(input->b, input->b + start, input->len - start);
+			input->len -= start;
+			scanned -= start;
+			start = 0;
+			minirl->no_tty.next = 0;
+		}
+		if (input->capacity - input->len < NO_TTY_READ_SIZE
+		    && !buffer_grow(input, NO_TTY_READ_SIZE)) {
+			return NULL;
+		}
+
+		struct iovec const iov = {
+			.iov_base = input->b + input->len,
+			.iov_len = input->capacity - input->len
+		};
+		ssize_t const nread = (minirl->io->read != NULL)
+			? minirl->io->read(minirl->io_ctx, &iov, 1, true)
+			: -1;
+
+		STATS_ADD(minirl, reads, 1);
+
+		if (nread <= 0) {
+			break;
+		}
+		input->len += nread;
+	}
+
+	/* EOF. The last line may not end with a newline. */
+	minirl->no_tty.next = input->len;
+	if (input->len == start) {
+		return NULL;
+	}
+	input->b[input->len] = '\0';
+	*len = input->len - start;
+
+	return input->b + start;
+}
+
+/*
+ * Read a line, editing it in 'line_buf' if the input is a terminal.
+ * The line returned is only valid until the next line is read.
+ * Returns NULL on EOF or error.
+ */
+static char *
+minirl_line_read(
+	minirl_st * const minirl,
+	char const * const prompt,
+	struct buffer * const line_buf,
+	size_t * const len)
 {
 	char *line;
 
 	if (!minirl->options.force_isatty && !minirl->is_a_tty) {
 		/* Not a tty: read from file / pipe. In this mode we don't want any
 		 * limit to the line size, so we call a function to handle that. */
-		line = minirl_no_tty(minirl);
+		line = no_tty_line_read(minirl, len);
 	} else {
-		struct buffer line_buf;
-
-		buffer_init(&line_buf, 0);
-
-		int const line_length = minirl_raw(minirl, &line_buf, prompt);
+		int const line_length = minirl_raw(minirl, line_buf, prompt);
 
 		if (line_length == -1) {
 			line = NULL;
 		} else {
-			line = strdup(line_buf.b);
+			line = line_buf->b;
+			*len = line_length;
 		}
-
-		buffer_clear(&line_buf);
 	}
 
 	if (line == NULL) {
 		/* Some kind of error occurred, or CTRL-D pressed. */
 		char const nl = '\n';
-		int const res = io_write(minirl->out.fd, &nl, sizeof nl);
+		bool const res = output_append(minirl, &nl, sizeof nl);
 		(void)res;
 	}
+	output_flush(minirl);
 
 	return line;
 }
 
-/*
- * This is just a wrapper the user may want to call in order to make sure
- * the minirl returned buffer is freed with the same allocator it was
- * created with. Useful when the main program is using an alternative
- * allocator.
- */
-void
-minirl_line_free(void * const ptr)
+/* The high level function that is the main API of the minirl library.
+ * This function checks if the terminal has basic capabilities, just checking
+ * for a blacklist of stupid terminals, and later either calls the line
+ * editing function or uses dummy fgets() so that you will be able to type
+ * something even in the most desperate of the conditions. */
+char *
+minirl_readline(minirl_st * const minirl, char const * const prompt)
 {
-	free(ptr);
+	/* The line is edited in the instance's buffer, so only the copy is allocated. */
+	char const * const line = minirl_readline_view(minirl, prompt, NULL);
+
+	return (line != NULL) ? strdup(line) : NULL;
 }
 
+char const *
+minirl_readline_view(minirl_st * const minirl, char const * const prompt, size_t * const len)
+{
+	struct buffer * const line_buf = &minirl->line;
+	size_t line_len;
 
-/*
- * Free the history, but does not reset it. Only used when we have to
- * exit() to avoid memory leaks are reported by valgrind & co.
- */
-static void
-free_history(minirl_st * const minirl)
+	buffer_reset(line_buf);
+	if (line_buf->b == NULL && !buffer_init(line_buf, 0)) {
+		return NULL;
+	}
+
+	char const * const line = minirl_line_read(minirl, prompt, line_buf, &line_len);
+
+	if (line != NULL && len != NULL) {
+		*len = line_len;
+	}
+
+	return line;
+}
+
+ssize_t
+minirl_readline_into(
+	minirl_st * const minirl,
+	char const * const prompt,
+	char ** const line,
+	size_t * const size)
 {
-	if (minirl->history.history != NULL) {
-		for (size_t j = 0; j < minirl->history.current_len; j++) {
-			free(minirl->history.history[j]);
+	/* The caller's buffer is used as the line buffer, and grown as needed. */
+	struct buffer line_buf = {
+		.b = *line,
+		.len = 0,
+		.capacity = (*line != NULL && *size > 0) ? *size - 1 : 0
+	};
+	ssize_t result = -1;
+	size_t len;
+
+	if (line_buf.capacity == 0 && !buffer_grow(&line_buf, 0)) {
+		goto done;
+	}
+
+	char const * const text = minirl_line_read(minirl, prompt, &line_buf, &len);
+
+	if (text == NULL) {
+		goto done;
+	}
+	if (text != line_buf.b) {
+		/* A line read without a terminal is copied from the input. */
+		if (len >= line_buf.capacity
+		    && !buffer_grow(&line_buf, len - line_buf.capacity)) {
+			goto done;
 		}
-		free(minirl->history.history);
+		memcpy(line_buf.b, text, len + 1);
 	}
-}
+	result = len;
 
-/*
+done:
+	*line = line_buf.b;
+	*size = (line_buf.b != NULL) ? line_buf.capacity + 1 : 0;
+
+	return result;
+}
+
+/*
+ * Finish reading a line started by minirl_readline_start().
+ * Returns 'status'.
+ */
+static enum minirl_status
+nonblocking_line_end(minirl_st * const minirl, enum minirl_status const status)
+{
+	if (status != MINIRL_STATUS_LINE) {
+		/* As minirl_readline() does when it returns NULL. */
+		char const nl = '\n';
+		bool const res = output_append(minirl, &nl, sizeof nl);
+		(void)res;
+	}
+	if (minirl->nonblocking.edit) {
+		minirl_terminal_leave(minirl);
+	}
+	minirl->nonblocking.active = false;
+	output_flush(minirl);
+
+	return status;
+}
+
+/*
+ * Without a terminal the input is split into lines as it arrives, in the same
+ * way as minirl_no_tty() does.
+ */
+static enum minirl_status
+nonblocking_text_process(minirl_st * const minirl)
+{
+	minirl_state_st * const l = &minirl->state;
+	struct input_buffer * const ib = &minirl->input;
+	size_t const pending = input_buffer_pending(ib);
+	size_t len = 0;
+	bool found_newline = false;
+
+	/* The input is appended a contiguous span at a time, up to the newline. */
+	while (len < pending && !found_newline) {
+		size_t span_len;
+		char const * const span = input_buffer_span(ib, len, &span_len);
+		char const * const nl = memchr(span, '\n', span_len);
+		size_t const text_len = (nl != NULL) ? (size_t)(nl - span) : span_len;
+
+		if (!buffer_append(l->line_buf, span, text_len)) {
+			return MINIRL_STATUS_ERROR;
+		}
+		len += text_len;
+		found_newline = nl != NULL;
+	}
+	l->len = l->line_buf->len;
+
+	if (!found_newline) {
+		input_buffer_consume(ib, len);
+
+		return MINIRL_STATUS_PENDING;
+	}
+	/* Consume the newline too. */
+	input_buffer_consume(ib, len + 1);
+
+	return MINIRL_STATUS_LINE;
+}
+
+/*
+ * Process all of the complete keys in the input buffer. Any part of a key
+ * sequence at the end of the buffer is left until the rest of it arrives.
+ */
+static enum minirl_status
+nonblocking_input_process(minirl_st * const minirl)
+{
+	minirl_state_st * const l = &minirl->state;
+	struct input_buffer * const ib = &minirl->input;
+	enum minirl_status status = MINIRL_STATUS_PENDING;
+
+	if (!minirl->nonblocking.edit) {
+		async_print_process(minirl, false);
+		status = nonblocking_text_process(minirl);
+		goto done;
+	}
+
+	if (minirl->options.track_resize) {
+		minirl_resize_handle(minirl);
+	}
+	while (status == MINIRL_STATUS_PENDING
+	       && input_buffer_pending(ib) > 0
+	       && input_key_is_complete(minirl)) {
+		status = minirl_key_process(minirl);
+	}
+	if (status == MINIRL_STATUS_PENDING) {
+		async_print_process(minirl, true);
+		/* Keys that arrived first may have made the matches obsolete. */
+		async_completion_process(minirl);
+	}
+	if (status == MINIRL_STATUS_PENDING && minirl_state_refresh_pending(l)) {
+		/* Nothing more can be done until there is more input. */
+		minirl_refresh_pending(minirl);
+	}
+
+done:
+	if (status != MINIRL_STATUS_PENDING) {
+		nonblocking_line_end(minirl, status);
+	} else {
+		output_flush(minirl);
+	}
+
+	return status;
+}
+
+bool
+minirl_readline_start(minirl_st * const minirl, char const * const prompt)
+{
+	struct buffer * const prompt_buf = &minirl->nonblocking.prompt;
+	struct buffer * const line_buf = &minirl->line;
+	bool const edit = minirl->options.force_isatty || minirl->is_a_tty;
+
+	minirl_readline_stop(minirl);
+
+	/* The prompt is copied, as it must outlive the caller's string. */
+	buffer_reset(prompt_buf);
+	buffer_reset(line_buf);
+	if (!buffer_append(prompt_buf, prompt, strlen(prompt))
+	    || !buffer_append(line_buf, "", 0)) {
+		return false;
+	}
+
+	if (edit) {
+		if (minirl_terminal_enter(minirl) == -1) {
+			return false;
+		}
+	}
+	minirl->nonblocking.active = true;
+	minirl->nonblocking.edit = edit;
+
+	if (edit) {
+		minirl_edit_start(minirl, line_buf, prompt_buf->b);
+		output_flush(minirl);
+	} else {
+		memset(&minirl->state, 0, sizeof minirl->state);
+		minirl->state.line_buf = line_buf;
+	}
+
+	return true;
+}
+
+enum minirl_status
+minirl_feed(minirl_st * const minirl, char const * const bytes, size_t const len)
+{
+	struct buffer * const backlog = &minirl->nonblocking.backlog;
+
+	if (!minirl->nonblocking.active) {
+		return MINIRL_STATUS_ERROR;
+	}
+	if (backlog->len > 0 && len > 0 && !buffer_append(backlog, bytes, len)) {
+		return nonblocking_line_end(minirl, MINIRL_STATUS_ERROR);
+	}
+
+	/* Input left over from the previous line goes first. */
+	bool const from_backlog = backlog->len > 0;
+	char const * const input = from_backlog ? backlog->b : bytes;
+	size_t const input_len = from_backlog ? backlog->len : len;
+	size_t used = 0;
+	/* The input buffer may also hold input left over from the previous line. */
+	enum minirl_status status = nonblocking_input_process(minirl);
+
+	while (status == MINIRL_STATUS_PENDING && used < input_len) {
+		size_t const added =
+			input_buffer_append(&minirl->input, input + used, input_len - used);
+
+		if (added == 0) {
+			/* The input buffer is full of an unfinished key sequence. */
+			status = nonblocking_line_end(minirl, MINIRL_STATUS_ERROR);
+			break;
+		}
+		if (recorder_active(&minirl->recorder)) {
+			recorder_input(&minirl->recorder, input + used, added);
+		}
+		used += added;
+		status = nonblocking_input_process(minirl);
+	}
+
+	/* Keep the rest of the input for the next line. */
+	if (from_backlog) {
+		memmove(backlog->b, backlog->b + used, backlog->len - used);
+		backlog->len -= used;
+	} else if (used < input_len
+		   && !buffer_append(backlog, input + used, input_len - used)) {
+		status = MINIRL_STATUS_ERROR;
+	}
+
+	return status;
+}
+
+enum minirl_status
+minirl_on_readable(minirl_st * const minirl)
+{
+	enum minirl_status const status = minirl_feed(minirl, NULL, 0);
+
+	if (status != MINIRL_STATUS_PENDING) {
+		return status;
+	}
+
+	if (input_fill(minirl, false) < 0) {
+		if (!minirl->nonblocking.edit && minirl->state.len > 0) {
+			/* The last line doesn't end with a newline. */
+			return nonblocking_line_end(minirl, MINIRL_STATUS_LINE);
+		}
+
+		return nonblocking_line_end(minirl, MINIRL_STATUS_EOF);
+	}
+
+	return nonblocking_input_process(minirl);
+}
+
+enum minirl_status
+minirl_on_wakeup(minirl_st * const minirl)
+{
+	wakeup_drain(&minirl->wakeup);
+
+	return minirl_feed(minirl, NULL, 0);
+}
+
+void
+minirl_readline_stop(minirl_st * const minirl)
+{
+	if (!minirl->nonblocking.active) {
+		return;
+	}
+	if (minirl->nonblocking.edit) {
+		/* Leave the cursor on the line below the abandoned line. */
+		minirl_edit_done(minirl);
+		minirl_terminal_leave(minirl);
+		output_flush(minirl);
+	}
+	minirl->nonblocking.active = false;
+}
+
+/*
+ * This is just a wrapper the user may want to call in order to make sure
+ * the minirl returned buffer is freed with the same allocator it was
+ * created with. Useful when the main program is using an alternative
+ * allocator.
+ */
+void
+minirl_line_free(void * const ptr)
+{
+	free(ptr);
+}
+
+
+/*
  * This is the API call to add a new entry in the minirl history.
- * It uses a fixed array of char pointers that are shifted (memmoved)
- * when the history max length is reached in order to remove the older
- * entry and make room for the new one, so it is not exactly suitable for huge
- * histories, but will work well for a few hundred of entries.
- *
- * Using a circular buffer is smarter, but a bit more complex to handle.
+ * The history is a circular buffer, so when the history max length is
+ * reached the oldest entry is replaced by the new one.
  */
 int
 minirl_history_add(minirl_st * const minirl, char const * const line)
 {
-	if (minirl->history.max_len == 0) {
+	STATS_ADD(minirl, history_adds, 1);
+
+	return history_add(&minirl->history, line, strlen(line));
+}
+
+/*
+ * Set the maximum length for the history. This function can be called even
+ * if there is already some history, the function will make sure to retain
+ * just the latest 'len' elements if the new history length value is smaller
+ * than the amount of items already inside the history.
+ */
+int
+minirl_history_set_max_len(minirl_st * const minirl, size_t const len)
+{
+	if (len < 1) {
+		return 0;
+	}
+
+	return history_set_max_len(&minirl->history, len);
+}
+
+bool
+minirl_history_load(minirl_st * const minirl, char const * const filename)
+{
+	return history_load(&minirl->history, filename);
+}
+
+bool
+minirl_history_save(minirl_st * const minirl, char const * const filename)
+{
+	return history_save(&minirl->history, filename);
+}
+
+bool
+minirl_history_append_enable(minirl_st * const minirl, char const * const filename)
+{
+	return history_append_open(&minirl->history, filename);
+}
+
+void
+minirl_history_append_disable(minirl_st * const minirl)
+{
+	history_append_close(&minirl->history);
+}
+
+void
+minirl_text_delete(minirl_st * const minirl, size_t const start, size_t const end)
+{
+	minirl_state_st * const l = &minirl->state;
+	unsigned const delta = end - start;
+
+	if (delta == 0) {
+		return;
+	}
+
+	/* Move any text which is left, including the terminator */
+	char * const line = minirl_line_get(minirl);
+
+	minirl_state_line_edited(l, start, delta, 0);
+	memmove(&line[start], &line[start + delta], l->len + 1 - end);
+	l->len -= delta;
+
+	/* Now adjust the indexes */
+	if (l->pos > end) {
+		/* Move the insertion point back appropriately */
+		l->pos -= delta;
+	} else if (l->pos > start) {
+		/* Move the insertion point to the start */
+		l->pos = start;
+	}
+
+	minirl_state_refresh_required(l);
+}
+
+/* Insert text into the line at the current cursor position. */
+bool
+minirl_text_len_insert(
+	minirl_st * const minirl,
+	char const * const text,
+	size_t const length)
+{
+	return minirl_edit_insert(minirl, text, length);
+}
+
+bool
+minirl_text_insert(minirl_st * const minirl, char const * const text)
+{
+	return minirl_edit_insert(minirl, text, strlen(text));
+}
+
+/* The number of columns that 's' takes up on the terminal. */
+static size_t
+string_width(char const * const s, size_t const len)
+{
+	size_t width = 0;
+
+	for (size_t point = 0; point < len;) {
+		width += grapheme_width(s, len, point, &point);
+	}
+
+	return width;
+}
+
+static bool
+spaces_append(struct buffer * const ab, size_t count)
+{
+	static char const spaces[] = "                                ";
+
+	while (count > 0) {
+		size_t const len = (count < sizeof spaces - 1) ? count : sizeof spaces - 1;
+
+		if (!buffer_append(ab, spaces, len)) {
+			return false;
+		}
+		count -= len;
+	}
+
+	return true;
+}
+
+/* Render a table of the matches, with as many columns as fit the terminal. */
+static bool
+completion_listing_render(
+	minirl_st * const minirl,
+	char const * const * const matches,
+	size_t const count,
+	struct buffer * const ab)
+{
+	struct {
+		size_t len;
+		size_t width;
+	} *sizes = mem_alloc(&minirl->alloc, count * sizeof *sizes);
+	bool success = false;
+
+	if (sizes == NULL) {
+		goto done;
+	}
+
+	/* Find maximum completion width. */
+	size_t max = 0;
+
+	for (size_t i = 0; i < count; i++) {
+		sizes[i].len = strlen(matches[i]);
+		sizes[i].width = string_width(matches[i], sizes[i].len);
+		if (max < sizes[i].width) {
+			max = sizes[i].width;
+		}
+	}
+
+	/* Allow for a space between words. */
+	size_t num_cols = minirl_terminal_width(minirl) / (max + 1);
+
+	if (num_cols == 0) {
+		num_cols = 1;
+	}
+
+	success = buffer_append(ab, "\r\n", 2);
+	for (size_t i = 0; success && i < count;) {
+		for (size_t c = 0; success && c < num_cols && i < count; c++, i++) {
+			success = buffer_append(ab, matches[i], sizes[i].len);
+			/* Pad to the next column, if there is one. */
+			if (success && c + 1 < num_cols && i + 1 < count) {
+				success = spaces_append(ab, max + 1 - sizes[i].width);
+			}
+		}
+		success = success && buffer_append(ab, "\r\n", 2);
+	}
+
+done:
+	mem_free(&minirl->alloc, sizes);
+
+	return success;
+}
+
+/*
+ * Display the matches above the edit line. If there are lots of them the
+ * user is asked first, and the listing is kept until they answer.
+ */
+static void
+minirl_display_matches(
+	minirl_st * const minirl,
+	char const * const * const matches,
+	size_t const count)
+{
+	minirl_state_st * const l = &minirl->state;
+	size_t const query_items = minirl->options.completion_query_items;
+	struct buffer * const listing = &minirl->completion.listing;
+
+	if (query_items == 0 || count <= query_items) {
+		completion_listing_render(minirl, matches, count, &minirl->output);
+		/*
+		 * line state needs to be reset so that the cursor isn't moved
+		 * around during the terminal refresh.
+		 */
+		minirl_line_state_reset(minirl);
+		return;
+	}
+
+	buffer_reset(listing);
+	if (!completion_listing_render(minirl, matches, count, listing)) {
+		return;
+	}
+
+	struct buffer * const ab = &minirl->output;
+
+	if (buffer_append(ab, "\r\nDisplay all ", 14)
+	    && buffer_append_number(ab, count)
+	    && buffer_append(ab, " possibilities? (y or n)", 24)) {
+		l->completion_query = true;
+	}
+}
+
+/*
+ * Complete the word from 'start' to the cursor given the 'count' matches for
+ * it, which have the first 'common_len' bytes of 'matches[0]' in common.
+ * 'prefix' is whether that common prefix is itself one of the matches.
+ */
+static bool
+completion_apply(
+	minirl_st * const minirl,
+	unsigned const start,
+	char const * const * const matches,
+	size_t const count,
+	size_t const common_len,
+	bool const prefix,
+	bool const allow_prefix)
+{
+	bool did_some_completion;
+	bool res = false;
+	unsigned len = common_len;
+	unsigned start_from = 0;
+	unsigned const end = minirl_point_get(minirl);
+
+	/*
+	 * The portion of the match from the start to the cursor position
+	 * matches so it's only necessary to insert from that position now.
+	 * Exclude the characters that already match.
+	 */
+	start_from = end - start;
+	len -= end - start;
+
+	/* Insert the rest of the common prefix */
+
+	if (len > 0) {
+		if (!minirl_text_len_insert(minirl, &matches[0][start_from], len)) {
+			return false;
+		}
+		did_some_completion = true;
+	} else {
+		did_some_completion = false;
+	}
+
+	/* Is there only one completion? */
+	if (count == 1) {
+		res = true;
+		goto done;
+	}
+
+	/* Is the prefix valid? */
+	if (prefix && allow_prefix) {
+		res = true;
+		goto done;
+	}
+
+	/* Display matches if no progress was made */
+	if (!did_some_completion) {
+		minirl_display_matches(minirl, matches, count);
+	}
+
+done:
+	return res;
+}
+
+bool
+minirl_complete(
+	minirl_st * const minirl,
+	unsigned const start,
+	char const * const * const matches,
+	bool const allow_prefix)
+{
+	bool prefix;
+
+	if (matches == NULL || matches[0] == NULL) {
+		return false;
+	}
+
+	/* Identify a common prefix. */
+	unsigned len = strlen(matches[0]);
+	size_t count = 1;
+
+	prefix = true;
+	for (; matches[count] != NULL; count++) {
+		unsigned common;
+
+		for (common = 0; common < len; common++) {
+			if (matches[0][common] != matches[count][common]) {
+				break;
+			}
+		}
+		if (len != common) {
+			len = common;
+			prefix = !matches[count][len];
+		}
+	}
+
+	return completion_apply(minirl, start, matches, count, len, prefix, allow_prefix);
+}
+
+/* Forget the last completion from an index. */
+static void
+completion_cache_clear(minirl_st * const minirl)
+{
+	minirl_completion_index_free(minirl->completion.index);
+	minirl->completion.index = NULL;
+	buffer_clear(&minirl->completion.prefix);
+}
+
+bool
+minirl_complete_from_index(
+	minirl_st * const minirl,
+	unsigned const start,
+	minirl_completion_index_st * const index,
+	bool const allow_prefix)
+{
+	minirl_state_st const * const l = &minirl->state;
+
+	if (index == NULL || start > l->pos) {
+		return false;
+	}
+
+	char const * const word = l->line_buf->b + start;
+	size_t const word_len = l->pos - start;
+	struct buffer * const cached = &minirl->completion.prefix;
+	struct completion_range const *within = NULL;
+	struct completion_range found;
+
+	if (minirl->completion.index == index
+	    && cached->len <= word_len
+	    && memcmp(cached->b, word, cached->len) == 0) {
+		within = &minirl->completion.range;
+	}
+	completion_index_lookup(index, word, word_len, within, &found);
+
+	if (minirl->completion.index != index) {
+		completion_cache_clear(minirl);
+		minirl->completion.index = minirl_completion_index_ref(index);
+	}
+	buffer_reset(cached);
+	if (!buffer_append(cached, word, word_len)) {
+		/* The result just can't be narrowed down next time. */
+		completion_cache_clear(minirl);
+	}
+	minirl->completion.range = found;
+
+	if (found.count == 0) {
+		return false;
+	}
+
+	char const * const * const matches = &index->candidates[found.first];
+
+	/* The shortest candidate comes first, so is the prefix if any is. */
+	return completion_apply(minirl,
+				start,
+				matches,
+				found.count,
+				found.common_len,
+				matches[0][found.common_len] == '\0',
+				allow_prefix);
+}
+
+unsigned long
+minirl_complete_async(minirl_st * const minirl, unsigned const start)
+{
+	minirl_state_st const * const l = &minirl->state;
+	struct buffer * const line = &minirl->async_completion.line;
+
+	async_completion_cancel(minirl);
+
+	buffer_reset(line);
+	if (!wakeup_open(&minirl->wakeup)
+	    || !buffer_append(line, l->line_buf->b, l->len)) {
 		return 0;
 	}
+	minirl->async_completion.start = start;
+	minirl->async_completion.pos = l->pos;
 
-	/* Initialization on first call. */
-	if (minirl->history.history == NULL) {
-		minirl->history.history =
-			calloc(sizeof(*minirl->history.history), minirl->history.max_len);
-		if (minirl->history.history == NULL) {
-			return 0;
-		}
+	/* 0 means that there is no request. */
+	if (++minirl->async_completion.last_token == 0) {
+		minirl->async_completion.last_token++;
 	}
 
-	/* Don't add duplicated lines. */
-	if (minirl->history.current_len > 0
-	    && strcmp(minirl->history.history[minirl->history.current_len - 1], line) == 0) {
-		return 0;
-	}
+	unsigned long const token = minirl->async_completion.last_token;
 
-	/*
-	 * Add a heap allocated copy of the line in the history.
-	 * If we reached the max length, remove the older line.
-	 */
-	char * const linecopy = strdup(line);
+	__atomic_store_n(&minirl->async_completion.token, token, __ATOMIC_RELEASE);
 
-	if (linecopy == NULL) {
-		return 0;
-	}
-	if (minirl->history.current_len == minirl->history.max_len) {
-		free(minirl->history.history[0]);
-		memmove(minirl->history.history,
-			minirl->history.history + 1,
-			sizeof(char *) * (minirl->history.max_len - 1));
-		minirl->history.current_len--;
-	}
-	minirl->history.history[minirl->history.current_len] = linecopy;
-	minirl->history.current_len++;
+	return token;
+}
 
-	return 1;
+bool
+minirl_complete_is_pending(minirl_st * const minirl, unsigned long const token)
+{
+	return token != 0
+	       && __atomic_load_n(&minirl->async_completion.token, __ATOMIC_ACQUIRE) == token;
 }
 
-/*
- * Set the maximum length for the history. This function can be called even
- * if there is already some history, the function will make sure to retain
- * just the latest 'len' elements if the new history length value is smaller
- * than the amount of items already inside the history.
- */
-int
-minirl_history_set_max_len(minirl_st * const minirl, size_t const len)
+bool
+minirl_complete_deliver(
+	minirl_st * const minirl,
+	unsigned long const token,
+	char const * const * const matches,
+	bool const allow_prefix)
 {
-	if (len < 1) {
-		return 0;
+	if (!minirl_complete_is_pending(minirl, token)) {
+		/* The matches are no longer wanted. */
+		return true;
 	}
-	if (minirl->history.history) {
-		size_t tocopy = minirl->history.current_len;
-		char ** const new_history = calloc(sizeof(*new_history), len);
 
-		if (new_history == NULL) {
-			return 0;
-		}
+	/* Copy the matches into a single block which the edit loop frees. */
+	size_t count = 0;
+	size_t size = 0;
 
-		/* If we can't copy everything, free the elements we'll not use. */
-		if (len < tocopy) {
-			for (size_t j = 0; j < tocopy - len; j++) {
-				free(minirl->history.history[j]);
-			}
-			tocopy = len;
-		}
-		memcpy(new_history,
-		       minirl->history.history + (minirl->history.current_len - tocopy),
-		       sizeof(char *) * tocopy);
-		free(minirl->history.history);
-		minirl->history.history = new_history;
+	for (; matches[count] != NULL; count++) {
+		size += strlen(matches[count]) + 1;
 	}
-	minirl->history.max_len = len;
-	if (minirl->history.current_len > minirl->history.max_len) {
-		minirl->history.current_len = minirl->history.max_len;
-	}
-
-	return 1;
-}
 
-void
-minirl_text_delete(minirl_st * const minirl, size_t const start, size_t const end)
-{
-	minirl_state_st * const l = &minirl->state;
-	unsigned const delta = end - start;
+	struct completion_delivery * const delivered =
+		malloc(sizeof *delivered + (count + 1) * sizeof *delivered->matches + size);
 
-	if (delta == 0) {
-		return;
+	if (delivered == NULL) {
+		return false;
 	}
+	delivered->token = token;
+	delivered->allow_prefix = allow_prefix;
 
-	/* Move any text which is left, including the terminator */
-	char * const line = minirl_line_get(minirl);
-	memmove(&line[start], &line[start + delta], l->len + 1 - end);
-	l->len -= delta;
+	char *strings = (char *)&delivered->matches[count + 1];
 
-	/* Now adjust the indexes */
-	if (l->pos > end) {
-		/* Move the insertion point back appropriately */
-		l->pos -= delta;
-	} else if (l->pos > start) {
-		/* Move the insertion point to the start */
-		l->pos = start;
+	for (size_t i = 0; i < count; i++) {
+		size_t const len = strlen(matches[i]) + 1;
+
+		memcpy(strings, matches[i], len);
+		delivered->matches[i] = strings;
+		strings += len;
 	}
+	delivered->matches[count] = NULL;
 
-	minirl_state_refresh_required(l);
-}
+	free(__atomic_exchange_n(&minirl->async_completion.delivered, delivered, __ATOMIC_ACQ_REL));
+	wakeup_signal(&minirl->wakeup);
 
-/* Insert text into the line at the current cursor position. */
-bool
-minirl_text_len_insert(
-	minirl_st * const minirl,
-	char const * const text,
-	size_t const length)
-{
-	return minirl_edit_insert(minirl, text, length);
+	return true;
 }
 
-bool
-minirl_text_insert(minirl_st * const minirl, char const * const text)
+int
+minirl_wakeup_fd(minirl_st * const minirl)
 {
-	return minirl_edit_insert(minirl, text, strlen(text));
+	if (!wakeup_open(&minirl->wakeup)) {
+		return -1;
+	}
+
+	return wakeup_fd(&minirl->wakeup);
 }
 
-static void
-minirl_display_matches(minirl_st * const minirl, char const * const * const matches)
+static bool
+default_keys_bind(minirl_keymap_st * const keymap)
 {
-	size_t max;
+	static struct {
+		uint8_t key;
+		minirl_key_binding_handler_cb handler;
+	} const key_bindings[] = {
+		{ CTRL('a'), home_handler },
+		{ CTRL('b'), left_handler },
+		{ CTRL('c'), ctrl_c_handler },
+		{ CTRL('d'), ctrl_d_handler },
+		{ CTRL('e'), end_handler },
+		{ CTRL('f'), right_handler },
+		{ CTRL('g'), abort_handler },
+		{ CTRL('h'), backspace_handler },
+		{ CTRL('k'), ctrl_k_handler },
+		{ CTRL('l'), ctrl_l_handler },
+		{ CTRL('n'), down_handler },
+		{ CTRL('p'), up_handler },
+		{ CTRL('r'), reverse_search_handler },
+		{ CTRL('t'), ctrl_t_handler },
+		{ CTRL('u'), ctrl_u_handler },
+		{ CTRL('w'), ctrl_w_handler },
+
+		{ ENTER, enter_handler },
+		{ BACKSPACE, backspace_handler },
+	};
+	static struct {
+		char const *seq;
+		minirl_key_binding_handler_cb handler;
+	} const sequence_bindings[] = {
+		{ ESCAPESTR "[2~", null_handler }, /* Insert. */
+		{ ESCAPESTR "[3~", delete_handler },
+		{ ESCAPESTR "[A", up_handler },
+		{ ESCAPESTR "[B", down_handler },
+		{ ESCAPESTR "[C", right_handler },
+		{ ESCAPESTR "[D", left_handler },
+		{ ESCAPESTR "[H", home_handler },
+		{ ESCAPESTR "[F", end_handler },
+		{ ESCAPESTR "OH", home_handler },
+		{ ESCAPESTR "OF", end_handler },
+		{ ESCAPESTR "[200~", paste_start_handler },
+		{ ESCAPESTR "[201~", paste_end_handler },
+	};
 
-	/* Find maximum completion length. */
-	max = 0;
-	for (char const * const *m = matches; *m != NULL; m++) {
-		size_t const size = strlen(*m);
+	for (size_t i = 32; i < 256; i++) {
+		char const seq[2] = { i, '\0' };
 
-		if (max < size) {
-			max = size;
+		if (!minirl_keymap_bind(keymap, seq, default_handler, NULL)) {
+			return false;
 		}
 	}
+	for (size_t i = 0; i < ARRAY_SIZE(key_bindings); i++) {
+		char const seq[2] = { key_bindings[i].key, '\0' };
 
-	/* Allow for a space between words. */
-	size_t const num_cols = minirl_terminal_width(minirl) / (max + 1);
-
-	/* Print out a table of completions. */
-	fprintf(minirl->out.stream, "\r\n");
-	for (char const * const *m = matches; *m != NULL;) {
-		for (size_t c = 0; c < num_cols && *m; c++, m++) {
-			fprintf(minirl->out.stream, "%-*s ", (int)max, *m);
+		if (!minirl_keymap_bind(keymap, seq, key_bindings[i].handler, NULL)) {
+			return false;
 		}
-		fprintf(minirl->out.stream, "\r\n");
 	}
+	for (size_t i = 0; i < ARRAY_SIZE(sequence_bindings); i++) {
+		if (!minirl_keymap_bind(keymap,
+					sequence_bindings[i].seq,
+					sequence_bindings[i].handler,
+					NULL)) {
+			return false;
+		}
+	}
+
+	return true;
 }
 
-bool
-minirl_complete(
-	minirl_st * const minirl,
-	unsigned const start,
-	char const * const * const matches,
-	bool const allow_prefix)
+/*
+ * The config used by minirl_new(). It is built the first time it is needed
+ * and then shared by every instance.
+ */
+static minirl_config_st *default_config;
+
+static minirl_config_st *
+default_config_get(void)
 {
-	bool did_some_completion;
-	bool prefix;
-	bool res = false;
+	minirl_config_st *config = __atomic_load_n(&default_config, __ATOMIC_ACQUIRE);
 
-	if (matches == NULL || matches[0] == NULL) {
-		return false;
+	if (config != NULL) {
+		return config;
 	}
 
-	/* Identify a common prefix. */
-	unsigned len = strlen(matches[0]);
-	prefix = true;
-	for (size_t i = 1; matches[i] != NULL; i++) {
-		unsigned common;
+	config = calloc(1, sizeof *config);
+	if (config == NULL) {
+		return NULL;
+	}
+	config->refs = 1;
+	config->keymap = minirl_keymap_new();
+	if (config->keymap == NULL || !default_keys_bind(config->keymap)) {
+		minirl_config_free(config);
+		return NULL;
+	}
+	config->options.refresh_budget_ms = DEFAULT_REFRESH_BUDGET_MS;
+	config->options.completion_query_items = DEFAULT_COMPLETION_QUERY_ITEMS;
+	config->history_max_len = MINIRL_DEFAULT_HISTORY_MAX_LEN;
+
+	/* Another thread may have got here first. */
+	minirl_config_st *expected = NULL;
+
+	if (!__atomic_compare_exchange_n(&default_config,
+					 &expected,
+					 config,
+					 false,
+					 __ATOMIC_ACQ_REL,
+					 __ATOMIC_ACQUIRE)) {
+		minirl_config_free(config);
+		config = expected;
+	}
 
-		for (common = 0; common < len; common++) {
-			if (matches[0][common] != matches[i][common]) {
-				break;
-			}
-		}
-		if (len != common) {
-			len = common;
-			prefix = !matches[i][len];
-		}
+	return config;
+}
+
+minirl_config_st *
+minirl_config_new(minirl_st * const minirl)
+{
+	minirl_config_st * const config = calloc(1, sizeof *config);
+
+	if (config == NULL) {
+		return NULL;
 	}
+	config->refs = 1;
+	config->keymap = minirl_keymap_ref(minirl->keymap);
+	config->options = minirl->options;
+	config->history_max_len = minirl->history.max_len;
 
-	unsigned start_from = 0;
-	unsigned const end = minirl_point_get(minirl);
+	return config;
+}
 
-	/*
-	 * The portion of the match from the start to the cursor position
-	 * matches so it's only necessary to insert from that position now.
-	 * Exclude the characters that already match.
-	 */
-	start_from = end - start;
-	len -= end - start;
+minirl_config_st *
+minirl_config_ref(minirl_config_st * const config)
+{
+	__atomic_add_fetch(&config->refs, 1, __ATOMIC_RELAXED);
 
-	/* Insert the rest of the common prefix */
+	return config;
+}
 
-	if (len > 0) {
-		if (!minirl_text_len_insert(minirl, &matches[0][start_from], len)) {
-			return false;
-		}
-		did_some_completion = true;
-	} else {
-		did_some_completion = false;
+void
+minirl_config_free(minirl_config_st * const config)
+{
+	if (config != NULL && __atomic_sub_fetch(&config->refs, 1, __ATOMIC_ACQ_REL) == 0) {
+		minirl_keymap_free(config->keymap);
+		free(config);
 	}
+}
 
-	/* Is there only one completion? */
-	if (matches[1] == NULL) {
-		res = true;
+static minirl_st *
+minirl_alloc(
+	minirl_io_st const * const io,
+	void * const io_ctx,
+	minirl_config_st * const config,
+	minirl_allocator_st const * const allocator,
+	void * const allocator_ctx)
+{
+	struct allocator const alloc = { .ops = allocator, .ctx = allocator_ctx };
+	minirl_st *minirl = mem_calloc(&alloc, 1, sizeof *minirl);
+
+	if (minirl == NULL) {
 		goto done;
 	}
 
-	/* Is the prefix valid? */
-	if (prefix && allow_prefix) {
-		res = true;
-		goto done;
+	minirl->alloc = alloc;
+
+	struct buffer * const buffers[] = {
+		&minirl->output,
+		&minirl->echo_mask,
+		&minirl->history_scratch,
+		&minirl->search.query,
+		&minirl->search.prompt,
+		&minirl->search.line,
+		&minirl->line,
+		&minirl->nonblocking.prompt,
+		&minirl->nonblocking.backlog,
+		&minirl->no_tty.input,
+		&minirl->completion.prefix,
+		&minirl->completion.listing,
+		&minirl->async_completion.line
+	};
+
+	for (size_t i = 0; i < ARRAY_SIZE(buffers); i++) {
+		buffers[i]->alloc = &minirl->alloc;
 	}
 
-	/* Display matches if no progress was made */
-	if (!did_some_completion) {
-		/*
-		 * line state needs to be reset so that the cursor isn't moved
-		 * around during the terminal refresh.
-		 */
-		minirl_display_matches(minirl, matches);
-		minirl_line_state_reset(minirl);
+	/* The keymap is only copied if the instance binds keys of its own. */
+	minirl->keymap = minirl_keymap_ref(config->keymap);
+	minirl->options = config->options;
+
+	minirl->io = io;
+	minirl->io_ctx = io_ctx;
+	minirl->in.fd = -1;
+	minirl->out.fd = -1;
+	minirl->is_a_tty = true;
+
+	input_buffer_init(&minirl->input);
+	display_init(&minirl->display, &minirl->alloc);
+	display_init(&minirl->shadow, &minirl->alloc);
+	layout_init(&minirl->layout, &minirl->alloc);
+	print_queue_init(&minirl->print_queue);
+	wakeup_init(&minirl->wakeup);
+	recorder_init(&minirl->recorder, &minirl->alloc);
+	replay_init(&minirl->replay, &minirl->alloc);
+
+	history_init(&minirl->history, config->history_max_len, &minirl->alloc);
+
+	if (minirl->options.track_resize) {
+		minirl_resize_tracking_enable(minirl);
 	}
 
 done:
-	return res;
+	return minirl;
 }
 
 struct minirl_st *
-minirl_new(FILE * const in_stream, FILE * const out_stream)
+minirl_new_with_config(
+	FILE * const in_stream,
+	FILE * const out_stream,
+	minirl_config_st * const config)
 {
-	minirl_st *minirl = calloc(1, sizeof *minirl);
+	minirl_st * const minirl = minirl_alloc(&fd_io, NULL, config, NULL, NULL);
 
 	if (minirl == NULL) {
 		goto done;
 	}
 
-	minirl->keymap = minirl_keymap_new();
-	if (minirl->keymap == NULL) {
-		free(minirl);
-		minirl = NULL;
-
-		goto done;
-	}
-
-	for (size_t i = 32; i < 256; i++) {
-		minirl_bind_key(minirl, i, default_handler, NULL);
-	}
-
-	minirl_bind_key(minirl, CTRL('a'), home_handler, NULL);
-	minirl_bind_key(minirl, CTRL('b'), left_handler, NULL);
-	minirl_bind_key(minirl, CTRL('c'), ctrl_c_handler, NULL);
-	minirl_bind_key(minirl, CTRL('d'), ctrl_d_handler, NULL);
-	minirl_bind_key(minirl, CTRL('e'), end_handler, NULL);
-	minirl_bind_key(minirl, CTRL('f'), right_handler, NULL);
-	minirl_bind_key(minirl, CTRL('h'), backspace_handler, NULL);
-	minirl_bind_key(minirl, CTRL('k'), ctrl_k_handler, NULL);
-	minirl_bind_key(minirl, CTRL('l'), ctrl_l_handler, NULL);
-	minirl_bind_key(minirl, CTRL('n'), down_handler, NULL);
-	minirl_bind_key(minirl, CTRL('p'), up_handler, NULL);
-	minirl_bind_key(minirl, CTRL('t'), ctrl_t_handler, NULL);
-	minirl_bind_key(minirl, CTRL('u'), ctrl_u_handler, NULL);
-	minirl_bind_key(minirl, CTRL('w'), ctrl_w_handler, NULL);
-
-	minirl_bind_key(minirl, ENTER, enter_handler, NULL);
-	minirl_bind_key(minirl, BACKSPACE, backspace_handler, NULL);
-
-	minirl_bind_key_sequence(minirl, ESCAPESTR "[2~", null_handler, NULL); /* Insert. */
-	minirl_bind_key_sequence(minirl, ESCAPESTR "[3~", delete_handler, NULL);
-	minirl_bind_key_sequence(minirl, ESCAPESTR "[A", up_handler, NULL);
-	minirl_bind_key_sequence(minirl, ESCAPESTR "[B", down_handler, NULL);
-	minirl_bind_key_sequence(minirl, ESCAPESTR "[C", right_handler, NULL);
-	minirl_bind_key_sequence(minirl, ESCAPESTR "[D", left_handler, NULL);
-	minirl_bind_key_sequence(minirl, ESCAPESTR "[H", home_handler, NULL);
-	minirl_bind_key_sequence(minirl, ESCAPESTR "[F", end_handler, NULL);
-	minirl_bind_key_sequence(minirl, ESCAPESTR "OH", home_handler, NULL);
-	minirl_bind_key_sequence(minirl, ESCAPESTR "OF", end_handler, NULL);
-
+	minirl->io_ctx = minirl;
 
 	minirl->in.stream = in_stream;
 	minirl->in.fd = fileno(in_stream);
@@ -1750,12 +3940,75 @@ minirl_new(FILE * const in_stream, FILE * const out_stream)
 	minirl->out.stream = out_stream;
 	minirl->out.fd = fileno(out_stream);
 
-	minirl->history.max_len = MINIRL_DEFAULT_HISTORY_MAX_LEN;
-
 done:
 	return minirl;
 }
 
+struct minirl_st *
+minirl_new_with_io(
+	minirl_io_st const * const io,
+	void * const ctx,
+	minirl_config_st * const config)
+{
+	return minirl_new_with_allocator(io, ctx, config, NULL, NULL);
+}
+
+struct minirl_st *
+minirl_new_with_allocator(
+	minirl_io_st const * const io,
+	void * const io_ctx,
+	minirl_config_st *config,
+	minirl_allocator_st const * const allocator,
+	void * const allocator_ctx)
+{
+	if (config == NULL) {
+		config = default_config_get();
+		if (config == NULL) {
+			return NULL;
+		}
+	}
+
+	return minirl_alloc(io, io_ctx, config, allocator, allocator_ctx);
+}
+
+struct minirl_st *
+minirl_replay_new(char const * const filename, bool const paced, minirl_config_st *config)
+{
+	if (config == NULL) {
+		config = default_config_get();
+		if (config == NULL) {
+			return NULL;
+		}
+	}
+
+	minirl_st * const minirl = minirl_alloc(&replay_io, NULL, config, NULL, NULL);
+
+	if (minirl == NULL) {
+		return NULL;
+	}
+	if (!replay_open(&minirl->replay, filename, paced)) {
+		minirl_delete(minirl);
+		return NULL;
+	}
+	minirl->io_ctx = &minirl->replay;
+	/* The width comes from the recording rather than SIGWINCH. */
+	minirl->options.track_resize = false;
+
+	return minirl;
+}
+
+struct minirl_st *
+minirl_new(FILE * const in_stream, FILE * const out_stream)
+{
+	minirl_config_st * const config = default_config_get();
+
+	if (config == NULL) {
+		return NULL;
+	}
+
+	return minirl_new_with_config(in_stream, out_stream, config);
+}
+
 void
 minirl_delete(minirl_st * const minirl)
 {
@@ -1769,9 +4022,34 @@ minirl_delete(minirl_st * const minirl)
 	minirl_keymap_free(minirl->keymap);
 	minirl->keymap = NULL;
 
-	free_history(minirl);
+	history_free(&minirl->history);
+	buffer_clear(&minirl->history_scratch);
+	buffer_clear(&minirl->search.query);
+	buffer_clear(&minirl->search.prompt);
+	buffer_clear(&minirl->search.line);
+	buffer_clear(&minirl->nonblocking.prompt);
+	buffer_clear(&minirl->line);
+	buffer_clear(&minirl->no_tty.input);
+	completion_cache_clear(minirl);
+	buffer_clear(&minirl->completion.listing);
+	async_completion_cancel(minirl);
+	buffer_clear(&minirl->async_completion.line);
+	print_queue_free(&minirl->print_queue);
+	wakeup_close(&minirl->wakeup);
+	buffer_clear(&minirl->nonblocking.backlog);
+	display_free(&minirl->display);
+	display_free(&minirl->shadow);
+	buffer_clear(&minirl->echo_mask);
+	layout_free(&minirl->layout);
+	buffer_clear(&minirl->output);
+	if (recorder_active(&minirl->recorder)) {
+		recorder_close(&minirl->recorder);
+	}
+	replay_free(&minirl->replay);
+
+	struct allocator const alloc = minirl->alloc;
 
-	free(minirl);
+	mem_free(&alloc, minirl);
 
 done:
 	return;
@@ -1820,3 +4098,95 @@ minirl_echo_disable(minirl_st * const minirl, char const echo_char)
 	minirl->options.echo.ch = echo_char;
 }
 
+void
+minirl_bracketed_paste_enable(minirl_st * const minirl)
+{
+	minirl->options.bracketed_paste = true;
+}
+
+void
+minirl_bracketed_paste_disable(minirl_st * const minirl)
+{
+	minirl->options.bracketed_paste = false;
+}
+
+void
+minirl_refresh_budget_set(minirl_st * const minirl, unsigned const milliseconds)
+{
+	minirl->options.refresh_budget_ms = milliseconds;
+}
+
+void
+minirl_completion_query_items_set(minirl_st * const minirl, size_t const items)
+{
+	minirl->options.completion_query_items = items;
+}
+
+void
+minirl_stats_enable(minirl_st * const minirl)
+{
+	minirl->stats.enabled = true;
+	minirl_stats_reset(minirl);
+}
+
+void
+minirl_stats_disable(minirl_st * const minirl)
+{
+	minirl->stats.enabled = false;
+}
+
+void
+minirl_stats_reset(minirl_st * const minirl)
+{
+	memset(&minirl->stats.counts, 0, sizeof minirl->stats.counts);
+	minirl->stats.reads_base = minirl->input.reads;
+}
+
+bool
+minirl_stats_get(minirl_st const * const minirl, minirl_stats_st * const stats)
+{
+	if (!minirl->stats.enabled) {
+		return false;
+	}
+	*stats = minirl->stats.counts;
+	/* Reads of the input buffer are counted by the buffer itself. */
+	stats->reads += minirl->input.reads - minirl->stats.reads_base;
+
+	return true;
+}
+
+bool
+minirl_trace_key_set(
+	minirl_st * const minirl,
+	minirl_trace_key_cb const cb,
+	void * const user_ctx)
+{
+#ifdef ENABLE_TRACE
+	minirl->trace.key = cb;
+	minirl->trace.key_ctx = user_ctx;
+
+	return true;
+#else
+	return false;
+#endif
+}
+
+bool
+minirl_record_start(minirl_st * const minirl, char const * const filename)
+{
+	if (!recorder_open(&minirl->recorder, filename)) {
+		return false;
+	}
+	/* Query the width again, so that it is recorded. */
+	minirl->terminal.width = 0;
+	minirl_terminal_width(minirl);
+
+	return true;
+}
+
+bool
+minirl_record_stop(minirl_st * const minirl)
+{
+	return recorder_close(&minirl->recorder);
+}
+
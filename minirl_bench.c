@@ -0,0 +1,989 @@
+/*
+ * Benchmark for minirl.
+ *
+ * Each scenario runs minirl_readline() on a pseudo-terminal and plays a
+ * script of input events into it, such as keys, pastes and terminal
+ * resizes. For each event it measures the time from writing the event to
+ * the terminal until minirl is waiting for input again, with all of its
+ * output written. For the whole scenario it counts what the editing thread
+ * did: the reads, writes, polls and ioctls on the terminal, the bytes
+ * written, and the allocations made.
+ *
+ * Sessions recorded with minirl_record_start() can be played as scenarios
+ * too, each read from the recording being an event.
+ *
+ * The results go to stdout, one JSON object per line for each scenario.
+ *
+ * Usage: minirl_bench [scenario...] [-r recording...]
+ * With no scenarios named every scenario is run, unless recordings are given.
+ */
+/* The calls interposed below must not be replaced by fortified versions. */
+#undef _FORTIFY_SOURCE
+
+#include "minirl.h"
+#include "recording.h"
+
+#include <dlfcn.h>
+#include <errno.h>
+#include <poll.h>
+#include <pthread.h>
+#include <pty.h>
+#include <semaphore.h>
+#include <signal.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/uio.h>
+#include <time.h>
+#include <unistd.h>
+
+#define ARRAY_SIZE(a) (sizeof(a)/sizeof((a)[0]))
+
+#define PROMPT "bench> "
+#define TERMINAL_ROWS 24
+#define TERMINAL_COLUMNS 80
+
+#define PASTE_SIZE (64 * 1024)
+#define MID_LINE_SIZE 4096
+#define HISTORY_ENTRIES 100000
+#define CANDIDATES 50000
+
+struct counters {
+	size_t reads;
+	size_t writes;
+	size_t polls;
+	size_t ioctls;
+	size_t bytes_written;
+	size_t allocations;
+};
+
+/*
+ * Calls are only counted for the thread running minirl_readline(), and
+ * only those on the terminal's fds.
+ */
+static __thread bool is_editor;
+
+static struct {
+	int in_fd;
+	int out_fd;
+	size_t pending;         /* Input written but not yet read by the editor. */
+	bool finishing;         /* The line being read is the last. */
+	sem_t idle;             /* Posted when the editor waits for more input. */
+	struct counters counters;
+} bench = {
+	.in_fd = -1,
+	.out_fd = -1
+};
+
+static __typeof__(read) *real_read;
+static __typeof__(readv) *real_readv;
+static __typeof__(write) *real_write;
+static __typeof__(writev) *real_writev;
+static __typeof__(poll) *real_poll;
+static __typeof__(ioctl) *real_ioctl;
+
+__attribute__((constructor))
+static void
+real_functions_find(void)
+{
+	real_read = dlsym(RTLD_NEXT, "read");
+	real_readv = dlsym(RTLD_NEXT, "readv");
+	real_write = dlsym(RTLD_NEXT, "write");
+	real_writev = dlsym(RTLD_NEXT, "writev");
+	real_poll = dlsym(RTLD_NEXT, "poll");
+	real_ioctl = dlsym(RTLD_NEXT, "ioctl");
+}
+
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t count, size_t size);
+extern void *__libc_realloc(void *ptr, size_t size);
+
+static bool
+is_counted(int const fd)
+{
+	return is_editor && (fd == bench.in_fd || fd == bench.out_fd);
+}
+
+/*
+ * Reading with all of the input read means that the editor is waiting for
+ * the rest of a key, such as an escape sequence split across events.
+ */
+static void
+input_read_start(int const fd)
+{
+	if (fd == bench.in_fd && __atomic_load_n(&bench.pending, __ATOMIC_ACQUIRE) == 0) {
+		sem_post(&bench.idle);
+	}
+}
+
+static void
+input_read(int const fd, ssize_t const len)
+{
+	if (fd == bench.in_fd && len > 0) {
+		__atomic_sub_fetch(&bench.pending, (size_t)len, __ATOMIC_RELEASE);
+	}
+}
+
+ssize_t
+read(int const fd, void * const buf, size_t const count)
+{
+	if (is_counted(fd)) {
+		input_read_start(fd);
+	}
+
+	ssize_t const res = real_read(fd, buf, count);
+
+	if (is_counted(fd)) {
+		bench.counters.reads++;
+		input_read(fd, res);
+	}
+
+	return res;
+}
+
+ssize_t
+readv(int const fd, struct iovec const * const iov, int const iov_count)
+{
+	if (is_counted(fd)) {
+		input_read_start(fd);
+	}
+
+	ssize_t const res = real_readv(fd, iov, iov_count);
+
+	if (is_counted(fd)) {
+		bench.counters.reads++;
+		input_read(fd, res);
+	}
+
+	return res;
+}
+
+ssize_t
+write(int const fd, void const * const buf, size_t const count)
+{
+	ssize_t const res = real_write(fd, buf, count);
+
+	if (is_counted(fd)) {
+		bench.counters.writes++;
+		if (res > 0) {
+			bench.counters.bytes_written += res;
+		}
+	}
+
+	return res;
+}
+
+ssize_t
+writev(int const fd, struct iovec const * const iov, int const iov_count)
+{
+	ssize_t const res = real_writev(fd, iov, iov_count);
+
+	if (is_counted(fd)) {
+		bench.counters.writes++;
+		if (res > 0) {
+			bench.counters.bytes_written += res;
+		}
+	}
+
+	return res;
+}
+
+/*
+ * poll() is declared as only writing to 'fds', so the compiler takes reading
+ * them to be reading uninitialized memory.
+ */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+int
+poll(struct pollfd * const fds, nfds_t const nfds, int const timeout)
+{
+	bool watches_input = false;
+
+	for (nfds_t i = 0; is_editor && i < nfds; i++) {
+		watches_input = watches_input || fds[i].fd == bench.in_fd;
+	}
+	if (watches_input) {
+		bench.counters.polls++;
+		/*
+		 * Waiting with all of the input read means that the last
+		 * event has been dealt with.
+		 */
+		if (timeout != 0 && __atomic_load_n(&bench.pending, __ATOMIC_ACQUIRE) == 0) {
+			sem_post(&bench.idle);
+		}
+	}
+
+	return real_poll(fds, nfds, timeout);
+}
+#pragma GCC diagnostic pop
+
+int
+ioctl(int const fd, unsigned long const request, ...)
+{
+	va_list args;
+
+	va_start(args, request);
+	void * const arg = va_arg(args, void *);
+	va_end(args);
+
+	if (is_counted(fd)) {
+		bench.counters.ioctls++;
+	}
+
+	return real_ioctl(fd, request, arg);
+}
+
+void *
+malloc(size_t const size)
+{
+	if (is_editor) {
+		bench.counters.allocations++;
+	}
+
+	return __libc_malloc(size);
+}
+
+void *
+calloc(size_t const count, size_t const size)
+{
+	if (is_editor) {
+		bench.counters.allocations++;
+	}
+
+	return __libc_calloc(count, size);
+}
+
+void *
+realloc(void * const ptr, size_t const size)
+{
+	if (is_editor) {
+		bench.counters.allocations++;
+	}
+
+	return __libc_realloc(ptr, size);
+}
+
+static void
+fail(char const * const what)
+{
+	perror(what);
+	exit(EXIT_FAILURE);
+}
+
+static uint64_t
+time_now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+enum event_type {
+	EVENT_INPUT,
+	EVENT_RESIZE
+};
+
+struct event {
+	enum event_type type;
+	size_t offset;          /* The event's input in the script's input. */
+	size_t len;
+	unsigned short columns; /* The new terminal width for a resize. */
+};
+
+struct script {
+	struct event *events;
+	size_t count;
+	size_t capacity;
+	char *input;
+	size_t input_len;
+	size_t input_capacity;
+};
+
+static struct event *
+script_event_add(struct script * const script, enum event_type const type)
+{
+	if (script->count == script->capacity) {
+		script->capacity = (script->capacity == 0) ? 256 : script->capacity * 2;
+		script->events = realloc(script->events, script->capacity * sizeof *script->events);
+		if (script->events == NULL) {
+			fail("realloc");
+		}
+	}
+
+	struct event * const event = &script->events[script->count++];
+
+	memset(event, 0, sizeof *event);
+	event->type = type;
+
+	return event;
+}
+
+/* Append input to the last event rather than starting a new one. */
+static void
+script_input_append(struct script * const script, char const * const input, size_t const len)
+{
+	if (script->input_len + len > script->input_capacity) {
+		while (script->input_len + len > script->input_capacity) {
+			script->input_capacity =
+				(script->input_capacity == 0) ? 4096 : script->input_capacity * 2;
+		}
+		script->input = realloc(script->input, script->input_capacity);
+		if (script->input == NULL) {
+			fail("realloc");
+		}
+	}
+	memcpy(script->input + script->input_len, input, len);
+	script->input_len += len;
+	script->events[script->count - 1].len += len;
+}
+
+static void
+script_input(struct script * const script, char const * const input, size_t const len)
+{
+	struct event * const event = script_event_add(script, EVENT_INPUT);
+
+	event->offset = script->input_len;
+	script_input_append(script, input, len);
+}
+
+/* Each key is a separate event. */
+static void
+script_keys(struct script * const script, char const * const keys, size_t const repeat)
+{
+	for (size_t i = 0; i < repeat; i++) {
+		script_input(script, keys, strlen(keys));
+	}
+}
+
+/* Type each char of 'text' as a separate event. */
+static void
+script_type(struct script * const script, char const * const text)
+{
+	for (char const *s = text; *s != '\0'; s++) {
+		script_input(script, s, 1);
+	}
+}
+
+static void
+script_paste(struct script * const script, char const * const text, size_t const len)
+{
+	static char const start[] = "\x1b[200~";
+	static char const end[] = "\x1b[201~";
+
+	script_input(script, start, strlen(start));
+	script_input_append(script, text, len);
+	script_input_append(script, end, strlen(end));
+}
+
+static void
+script_resize(struct script * const script, unsigned short const columns)
+{
+	script_event_add(script, EVENT_RESIZE)->columns = columns;
+}
+
+static void
+script_free(struct script * const script)
+{
+	free(script->events);
+	free(script->input);
+}
+
+/* A line of 'len' bytes made up of words of ASCII text. */
+static char *
+ascii_text(size_t const len)
+{
+	static char const words[] = "the quick brown fox jumps over the lazy dog ";
+	char * const text = malloc(len + 1);
+
+	if (text == NULL) {
+		fail("malloc");
+	}
+	for (size_t i = 0; i < len; i++) {
+		text[i] = words[i % (sizeof words - 1)];
+	}
+	text[len] = '\0';
+
+	return text;
+}
+
+/* A line of up to 'len' bytes of CJK text, all wide chars. */
+static char *
+cjk_text(size_t const len, size_t * const text_len)
+{
+	static char const chars[] = "\xe4\xb8\xad\xe6\x96\x87\xe5\xad\x97\xe7\xac\xa6";
+	size_t const char_count = len / 3;
+	char * const text = malloc(char_count * 3 + 1);
+
+	if (text == NULL) {
+		fail("malloc");
+	}
+	for (size_t i = 0; i < char_count; i++) {
+		memcpy(&text[i * 3], &chars[(i % 4) * 3], 3);
+	}
+	*text_len = char_count * 3;
+	text[*text_len] = '\0';
+
+	return text;
+}
+
+static void
+paste_setup(minirl_st * const minirl)
+{
+	minirl_bracketed_paste_enable(minirl);
+}
+
+static void
+paste_ascii_script(struct script * const script)
+{
+	char * const text = ascii_text(PASTE_SIZE);
+
+	script_paste(script, text, PASTE_SIZE);
+	free(text);
+}
+
+static void
+paste_cjk_script(struct script * const script)
+{
+	size_t len;
+	char * const text = cjk_text(PASTE_SIZE, &len);
+
+	script_paste(script, text, len);
+	free(text);
+}
+
+static void
+type_ascii_script(struct script * const script)
+{
+	char * const text = ascii_text(2000);
+
+	script_type(script, text);
+	free(text);
+}
+
+static void
+edit_mid_line_script(struct script * const script)
+{
+	char * const text = ascii_text(MID_LINE_SIZE);
+
+	script_paste(script, text, MID_LINE_SIZE);
+	free(text);
+
+	script_keys(script, "\x1b[H", 1);           /* Home. */
+	script_keys(script, "\x1b[C", MID_LINE_SIZE / 2);
+	script_keys(script, "x", 256);
+	script_keys(script, "\x7f", 256);          /* Backspace. */
+	script_keys(script, "\x1b[3~", 256);       /* Delete. */
+	script_keys(script, "\x17", 16);           /* CTRL-W. */
+	script_keys(script, "\x1b[D", 256);
+}
+
+static void
+history_setup(minirl_st * const minirl)
+{
+	minirl_history_set_max_len(minirl, HISTORY_ENTRIES);
+	for (size_t i = 0; i < HISTORY_ENTRIES; i++) {
+		char line[80];
+
+		snprintf(line, sizeof line, "command %06zu --verbose --output=/tmp/%zu.log", i, i % 977);
+		minirl_history_add(minirl, line);
+	}
+}
+
+static void
+history_script(struct script * const script)
+{
+	static char const * const queries[] = { "123", "0999", "--out", "/tmp/5", "zzz" };
+
+	script_keys(script, "\x1b[A", 1000);        /* Up. */
+	script_keys(script, "\x1b[B", 1000);        /* Down. */
+	for (size_t i = 0; i < ARRAY_SIZE(queries); i++) {
+		script_keys(script, "\x12", 1);     /* CTRL-R. */
+		script_type(script, queries[i]);
+		script_keys(script, "\x7f", 1);
+		script_keys(script, "\x07", 1);     /* CTRL-G. */
+	}
+}
+
+static char *candidates[CANDIDATES];
+static minirl_completion_index_st *candidate_index;
+
+static size_t
+word_start(minirl_st * const minirl)
+{
+	char const * const line = minirl_line_get(minirl);
+	size_t start = minirl_point_get(minirl);
+
+	while (start > 0 && line[start - 1] != ' ') {
+		start--;
+	}
+
+	return start;
+}
+
+/* Complete from the candidates in the way that most programs would. */
+static bool
+complete_handler(minirl_st * const minirl, char const * const key, void * const user_ctx)
+{
+	size_t const start = word_start(minirl);
+	char const * const word = minirl_line_get(minirl) + start;
+	size_t const word_len = minirl_point_get(minirl) - start;
+	char const ** const matches = malloc((CANDIDATES + 1) * sizeof *matches);
+	size_t count = 0;
+
+	if (matches == NULL) {
+		return false;
+	}
+	for (size_t i = 0; i < CANDIDATES; i++) {
+		if (strncmp(candidates[i], word, word_len) == 0) {
+			matches[count++] = candidates[i];
+		}
+	}
+	matches[count] = NULL;
+
+	bool const res = minirl_complete(minirl, start, matches, false);
+
+	free(matches);
+
+	return res;
+}
+
+static bool
+complete_index_handler(minirl_st * const minirl, char const * const key, void * const user_ctx)
+{
+	return minirl_complete_from_index(minirl, word_start(minirl), candidate_index, false);
+}
+
+static void
+candidates_make(void)
+{
+	if (candidates[0] != NULL) {
+		return;
+	}
+	for (size_t i = 0; i < CANDIDATES; i++) {
+		char name[32];
+
+		snprintf(name, sizeof name, "object%05zu", i);
+		candidates[i] = strdup(name);
+		if (candidates[i] == NULL) {
+			fail("strdup");
+		}
+	}
+	candidate_index =
+		minirl_completion_index_new((char const * const *)candidates, CANDIDATES);
+	if (candidate_index == NULL) {
+		fail("minirl_completion_index_new");
+	}
+}
+
+static void
+complete_setup(minirl_st * const minirl)
+{
+	candidates_make();
+	minirl_bind_key(minirl, '\t', complete_handler, NULL);
+}
+
+static void
+complete_index_setup(minirl_st * const minirl)
+{
+	candidates_make();
+	minirl_bind_key(minirl, '\t', complete_index_handler, NULL);
+}
+
+static void
+complete_script(struct script * const script)
+{
+	for (size_t i = 0; i < 20; i++) {
+		char digits[8];
+
+		snprintf(digits, sizeof digits, "%05zu", (i * 7919) % CANDIDATES);
+
+		script_type(script, "obj");
+		script_keys(script, "\t", 1);      /* Completes "object". */
+		script_keys(script, "\t", 1);      /* Asks about 50000 matches. */
+		script_keys(script, "n", 1);
+		script_input(script, &digits[0], 1);
+		script_keys(script, "\t", 1);      /* Asks about 10000 matches. */
+		script_keys(script, "n", 1);
+		script_input(script, &digits[1], 3);
+		script_keys(script, "\t", 1);      /* Lists 10 matches. */
+		script_input(script, &digits[4], 1);
+		script_keys(script, "\t", 1);      /* The only match. */
+		script_keys(script, "\x17", 1);    /* CTRL-W. */
+	}
+}
+
+static void
+resize_setup(minirl_st * const minirl)
+{
+	minirl_bracketed_paste_enable(minirl);
+}
+
+/* A long line that wraps over several rows, redrawn at different widths. */
+static void
+resize_script(struct script * const script)
+{
+	char * const text = ascii_text(2000);
+
+	script_paste(script, text, 2000);
+	free(text);
+	for (size_t i = 0; i < 100; i++) {
+		script_resize(script, (i % 2 == 0) ? 60 : TERMINAL_COLUMNS);
+	}
+}
+
+static void
+recording_fail(char const * const filename, size_t const offset, char const * const what)
+{
+	fprintf(stderr, "%s: %s at offset %zu\n", filename, what, offset);
+	exit(EXIT_FAILURE);
+}
+
+/* Make each read in a recording an input event, and each width a resize. */
+static void
+recording_script(char const * const filename, struct script * const script)
+{
+	FILE * const fp = fopen(filename, "rb");
+
+	if (fp == NULL) {
+		fail(filename);
+	}
+
+	char *data = NULL;
+	size_t len = 0;
+	size_t capacity = 0;
+
+	while (!feof(fp)) {
+		if (len == capacity) {
+			capacity = (capacity == 0) ? 65536 : capacity * 2;
+			data = realloc(data, capacity);
+			if (data == NULL) {
+				fail("realloc");
+			}
+		}
+		len += fread(data + len, 1, capacity - len, fp);
+		if (ferror(fp)) {
+			fail(filename);
+		}
+	}
+	fclose(fp);
+
+	size_t const header_len = strlen(RECORDING_HEADER);
+
+	if (len < header_len || memcmp(data, RECORDING_HEADER, header_len) != 0) {
+		recording_fail(filename, 0, "Not a minirl recording");
+	}
+	for (size_t offset = header_len; offset < len;) {
+		uint8_t type;
+		uint64_t time_us;
+		uint32_t value;
+
+		if (len - offset < RECORDING_EVENT_SIZE) {
+			recording_fail(filename, offset, "Truncated event");
+		}
+		/* Only the type and value are needed, not the time. */
+		recording_event_decode((uint8_t const *)data + offset, &type, &time_us, &value);
+		offset += RECORDING_EVENT_SIZE;
+		if (type == RECORDING_EVENT_WIDTH) {
+			script_resize(script, value);
+		} else if (type == RECORDING_EVENT_INPUT) {
+			if (len - offset < value) {
+				recording_fail(filename, offset - RECORDING_EVENT_SIZE, "Truncated event");
+			}
+			script_input(script, data + offset, value);
+			offset += value;
+		} else {
+			recording_fail(filename, offset - RECORDING_EVENT_SIZE, "Unknown event");
+		}
+	}
+	free(data);
+}
+
+struct scenario {
+	char const *name;
+	void (*setup)(minirl_st *minirl);
+	void (*script)(struct script *script);
+};
+
+static struct scenario const scenarios[] = {
+	{ "paste_ascii", paste_setup, paste_ascii_script },
+	{ "paste_cjk", paste_setup, paste_cjk_script },
+	{ "type_ascii", NULL, type_ascii_script },
+	{ "edit_mid_line", paste_setup, edit_mid_line_script },
+	{ "history", history_setup, history_script },
+	{ "complete", complete_setup, complete_script },
+	{ "complete_index", complete_index_setup, complete_script },
+	{ "resize", resize_setup, resize_script },
+};
+
+static void
+idle_wait(void)
+{
+	while (sem_wait(&bench.idle) == -1) {
+		if (errno != EINTR) {
+			fail("sem_wait");
+		}
+	}
+}
+
+static void
+write_all(int const fd, char const *data, size_t len)
+{
+	while (len > 0) {
+		ssize_t const res = write(fd, data, len);
+
+		if (res == -1) {
+			if (errno == EINTR) {
+				continue;
+			}
+			fail("write");
+		}
+		data += res;
+		len -= res;
+	}
+}
+
+/* Read and discard the terminal's output, so that the editor never blocks. */
+static void *
+output_drain(void * const arg)
+{
+	int const master = *(int const *)arg;
+	char buf[65536];
+
+	for (;;) {
+		ssize_t const res = read(master, buf, sizeof buf);
+
+		if (res == 0 || (res == -1 && errno != EINTR)) {
+			break;
+		}
+	}
+
+	return NULL;
+}
+
+static void *
+editor_run(void * const arg)
+{
+	minirl_st * const minirl = arg;
+	sigset_t winch;
+
+	/* Leave resize signals to the other threads, so as not to interrupt it. */
+	sigemptyset(&winch);
+	sigaddset(&winch, SIGWINCH);
+	pthread_sigmask(SIG_BLOCK, &winch, NULL);
+
+	/* A recording may hold several lines, or end one with Ctrl-D. */
+	is_editor = true;
+	for (;;) {
+		char * const line = minirl_readline(minirl, PROMPT);
+		bool const finished = __atomic_load_n(&bench.finishing, __ATOMIC_ACQUIRE);
+
+		free(line);
+		if (finished) {
+			break;
+		}
+	}
+	is_editor = false;
+
+	return NULL;
+}
+
+static int
+u64_compare(void const * const a, void const * const b)
+{
+	uint64_t const x = *(uint64_t const *)a;
+	uint64_t const y = *(uint64_t const *)b;
+
+	return (x > y) - (x < y);
+}
+
+static void
+results_print(
+	struct scenario const * const scenario,
+	struct script const * const script,
+	uint64_t * const latencies,
+	uint64_t const total_ns)
+{
+	struct counters const * const c = &bench.counters;
+	size_t const n = script->count;
+
+	qsort(latencies, n, sizeof *latencies, u64_compare);
+	printf("{\"scenario\":\"%s\",\"events\":%zu,\"input_bytes\":%zu,"
+	       "\"total_us\":%.1f,\"p50_us\":%.1f,\"p99_us\":%.1f,\"max_us\":%.1f,"
+	       "\"syscalls\":%zu,\"reads\":%zu,\"writes\":%zu,\"polls\":%zu,\"ioctls\":%zu,"
+	       "\"bytes_written\":%zu,\"allocations\":%zu}\n",
+	       scenario->name,
+	       n,
+	       script->input_len,
+	       total_ns / 1e3,
+	       latencies[(n - 1) * 50 / 100] / 1e3,
+	       latencies[(n - 1) * 99 / 100] / 1e3,
+	       latencies[n - 1] / 1e3,
+	       c->reads + c->writes + c->polls + c->ioctls,
+	       c->reads,
+	       c->writes,
+	       c->polls,
+	       c->ioctls,
+	       c->bytes_written,
+	       c->allocations);
+	fflush(stdout);
+}
+
+static void
+scenario_run(struct scenario const * const scenario, struct script * const script)
+{
+	struct winsize ws = { .ws_row = TERMINAL_ROWS, .ws_col = TERMINAL_COLUMNS };
+	int master;
+	int slave;
+
+	if (openpty(&master, &slave, NULL, NULL, &ws) == -1) {
+		fail("openpty");
+	}
+
+	FILE * const in = fdopen(slave, "r");
+	FILE * const out = fdopen(dup(slave), "w");
+
+	if (in == NULL || out == NULL) {
+		fail("fdopen");
+	}
+
+	minirl_st * const minirl = minirl_new(in, out);
+
+	if (minirl == NULL) {
+		fail("minirl_new");
+	}
+	minirl_resize_tracking_enable(minirl);
+	if (scenario->setup != NULL) {
+		scenario->setup(minirl);
+	}
+
+	uint64_t * const latencies = malloc(script->count * sizeof *latencies);
+
+	if (latencies == NULL) {
+		fail("malloc");
+	}
+
+	memset(&bench.counters, 0, sizeof bench.counters);
+	bench.pending = 0;
+	bench.finishing = false;
+	bench.in_fd = fileno(in);
+	bench.out_fd = fileno(out);
+	sem_init(&bench.idle, 0, 0);
+
+	pthread_t drain_thread;
+	pthread_t editor_thread;
+
+	if (pthread_create(&drain_thread, NULL, output_drain, &master) != 0
+	    || pthread_create(&editor_thread, NULL, editor_run, minirl) != 0) {
+		fail("pthread_create");
+	}
+
+	/* Wait for the prompt. */
+	idle_wait();
+
+	uint64_t const start = time_now_ns();
+
+	for (size_t i = 0; i < script->count; i++) {
+		struct event const * const event = &script->events[i];
+		uint64_t const event_start = time_now_ns();
+
+		switch (event->type) {
+		case EVENT_INPUT:
+			__atomic_add_fetch(&bench.pending, event->len, __ATOMIC_RELEASE);
+			write_all(master, script->input + event->offset, event->len);
+			break;
+
+		case EVENT_RESIZE:
+			ws.ws_col = event->columns;
+			if (ioctl(master, TIOCSWINSZ, &ws) == -1) {
+				fail("ioctl");
+			}
+			kill(getpid(), SIGWINCH);
+			break;
+		}
+		idle_wait();
+		latencies[i] = time_now_ns() - event_start;
+	}
+
+	uint64_t const total_ns = time_now_ns() - start;
+
+	/* Finish the line. */
+	__atomic_store_n(&bench.finishing, true, __ATOMIC_RELEASE);
+	write_all(master, "\r", 1);
+	pthread_join(editor_thread, NULL);
+
+	results_print(scenario, script, latencies, total_ns);
+
+	minirl_delete(minirl);
+	fclose(in);
+	fclose(out);
+	pthread_join(drain_thread, NULL);
+	close(master);
+	sem_destroy(&bench.idle);
+	bench.in_fd = -1;
+	bench.out_fd = -1;
+	free(latencies);
+}
+
+static bool
+scenario_named(int const argc, char ** const argv, char const * const name)
+{
+	for (int arg = 1; arg < argc; arg++) {
+		if (strcmp(argv[arg], "-r") == 0) {
+			arg++;
+		} else if (strcmp(argv[arg], name) == 0) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+int
+main(int const argc, char ** const argv)
+{
+	size_t run = 0;
+	bool const run_all = argc <= 1;
+
+	for (size_t i = 0; i < ARRAY_SIZE(scenarios); i++) {
+		if (run_all || scenario_named(argc, argv, scenarios[i].name)) {
+			struct script script = { 0 };
+
+			scenarios[i].script(&script);
+			scenario_run(&scenarios[i], &script);
+			script_free(&script);
+			run++;
+		}
+	}
+	for (int arg = 1; arg + 1 < argc; arg++) {
+		if (strcmp(argv[arg], "-r") != 0) {
+			continue;
+		}
+
+		/* Recordings may use bracketed paste, so it is enabled. */
+		struct scenario const scenario = { .name = argv[++arg], .setup = paste_setup };
+		struct script script = { 0 };
+
+		recording_script(scenario.name, &script);
+		if (script.count == 0) {
+			fprintf(stderr, "%s: The recording has no input\n", scenario.name);
+			return EXIT_FAILURE;
+		}
+		scenario_run(&scenario, &script);
+		script_free(&script);
+		run++;
+	}
+	if (run == 0) {
+		fprintf(stderr, "Unknown scenario. The scenarios are:\n");
+		for (size_t i = 0; i < ARRAY_SIZE(scenarios); i++) {
+			fprintf(stderr, "  %s\n", scenarios[i].name);
+		}
+
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
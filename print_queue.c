@@ -0,0 +1,77 @@
+#include "print_queue.h"
+#include "export.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+NO_EXPORT
+void
+print_queue_init(struct print_queue * const queue)
+{
+	queue->head = NULL;
+}
+
+NO_EXPORT
+void
+print_queue_free(struct print_queue * const queue)
+{
+	print_queue_messages_free(print_queue_take(queue));
+}
+
+NO_EXPORT
+bool
+print_queue_push(struct print_queue * const queue, char const * const text, size_t const len)
+{
+	struct print_message * const message = malloc(sizeof *message + len);
+
+	if (message == NULL) {
+		return false;
+	}
+	message->len = len;
+	memcpy(message->text, text, len);
+
+	/* The messages are kept as a stack, newest first. */
+	message->next = __atomic_load_n(&queue->head, __ATOMIC_RELAXED);
+	while (!__atomic_compare_exchange_n(&queue->head,
+					    &message->next,
+					    message,
+					    true,
+					    __ATOMIC_RELEASE,
+					    __ATOMIC_RELAXED)) {
+		/* message->next now holds the new head. */
+	}
+
+	return true;
+}
+
+NO_EXPORT
+struct print_message *
+print_queue_take(struct print_queue * const queue)
+{
+	struct print_message *message =
+		__atomic_exchange_n(&queue->head, NULL, __ATOMIC_ACQUIRE);
+	struct print_message *oldest_first = NULL;
+
+	/* Reverse the stack to get the messages in the order they were added. */
+	while (message != NULL) {
+		struct print_message * const next = message->next;
+
+		message->next = oldest_first;
+		oldest_first = message;
+		message = next;
+	}
+
+	return oldest_first;
+}
+
+NO_EXPORT
+void
+print_queue_messages_free(struct print_message *messages)
+{
+	while (messages != NULL) {
+		struct print_message * const next = messages->next;
+
+		free(messages);
+		messages = next;
+	}
+}
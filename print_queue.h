@@ -0,0 +1,43 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+
+struct print_message {
+	struct print_message *next;
+	size_t len;
+	char text[];
+};
+
+/*
+ * A queue of messages to print, which any number of threads can add to
+ * without locking, and the thread editing the line takes all at once.
+ */
+struct print_queue {
+	struct print_message *head; /* The latest message. */
+};
+
+void
+print_queue_init(struct print_queue *queue);
+
+/* Free any messages left in the queue. */
+void
+print_queue_free(struct print_queue *queue);
+
+/*
+ * Add a copy of 'text' to the queue. May be called from any thread.
+ * Return true if successful, else false.
+ */
+bool
+print_queue_push(struct print_queue *queue, char const *text, size_t len);
+
+/*
+ * Take all of the messages from the queue, oldest first. Only one thread may
+ * take messages at a time. Returns NULL if there are none.
+ * The messages are freed with print_queue_messages_free().
+ */
+struct print_message *
+print_queue_take(struct print_queue *queue);
+
+void
+print_queue_messages_free(struct print_message *messages);
@@ -1,22 +1,25 @@
 #pragma once
 
 #include "minirl.h"
+#include "alloc.h"
 #include "buffer.h"
+#include "completion_index.h"
+#include "display.h"
+#include "history.h"
+#include "input_buffer.h"
 #include "key_binding.h"
+#include "layout.h"
+#include "print_queue.h"
+#include "recording.h"
+#include "replay.h"
+#include "wakeup.h"
 
+#include <signal.h>
 #include <termios.h>
 
 #define MINIRL_DEFAULT_HISTORY_MAX_LEN 100
 #define MINIRL_MAX_LINE 4096
 
-/* The minirlState structure represents the state during line editing.
- * We pass this state to functions implementing specific editing
- * functionalities. */
-typedef struct cursor_st {
-	int row;
-	int col;
-} cursor_st;
-
 typedef struct minirl_key_handler_flags_st {
 	bool done;
 	bool refresh_required;
@@ -24,8 +27,12 @@ typedef struct minirl_key_handler_flags_st {
 	bool error;
 } minirl_key_handler_flags_st;
 
+/* The minirlState structure represents the state during line editing.
+ * We pass this state to functions implementing specific editing
+ * functionalities. */
 typedef struct minirl_state_st {
 	struct buffer *line_buf;
+	struct layout *layout;  /* Cached grapheme positions of the line. */
 
 	char const *prompt;     /* Prompt to display. */
 	size_t prompt_len;      /* Prompt length. */
@@ -34,12 +41,33 @@ typedef struct minirl_state_st {
 
 	size_t terminal_width;  /* Number of columns in terminal. */
 	size_t max_rows;        /* Maximum num of rows used so far */
-	int history_index;      /* The history index we are currently editing. */
+	size_t history_index;   /* The history index we are currently editing. */
+	struct {
+		bool valid;
+		size_t len;             /* The prefix that history entries must match. */
+		size_t pos;             /* The cursor position after the last entry was shown. */
+	} history_prefix;
+	bool in_paste;          /* Between bracketed paste start/end markers. */
+	bool completion_query;  /* Asking whether to list all the completions. */
+
+	struct {
+		bool active;
+		bool failed;            /* No entry matches the query. */
+		size_t age;             /* The age of the matching entry. */
+		/* The line as it was before searching. */
+		char const *prompt;
+		size_t prompt_len;
+		size_t pos;
+		size_t history_index;
+	} search;
 
 	cursor_st previous_cursor;
 	cursor_st previous_line_end;
 
 	minirl_key_handler_flags_st flags;
+	uint64_t dirty_since_ms; /* When a deferred refresh first became due. */
+	bool shadow_valid;      /* The shadow display matches the terminal. */
+	bool in_key_handler;    /* Output is flushed once the handler returns. */
 } minirl_state_st;
 
 typedef struct echo_st {
@@ -47,7 +75,29 @@ typedef struct echo_st {
 	char ch;
 } echo_st;
 
+typedef struct minirl_options_st {
+	bool mask_mode;
+	bool force_isatty;
+	bool bracketed_paste;
+	bool track_resize;
+	unsigned refresh_budget_ms;
+	size_t completion_query_items;
+	echo_st echo;
+} minirl_options_st;
+
+/* Settings shared by the instances created from them, which can't be changed. */
+struct minirl_config_st {
+	unsigned refs;
+	minirl_keymap_st *keymap;
+	minirl_options_st options;
+	size_t history_max_len;
+};
+
 struct minirl_st {
+	struct allocator alloc;         /* Where the instance's memory comes from. */
+	minirl_io_st const *io;
+	void *io_ctx;
+	/* The streams used by the default I/O callbacks. The fds are -1 if unused. */
 	struct {
 		FILE *stream;
 		int fd;
@@ -57,22 +107,87 @@ struct minirl_st {
 		int fd;
 	} out;
 
+	struct {
+		int width;              /* Cached width, 0 if unknown. */
+		sig_atomic_t generation; /* SIGWINCH count when width was cached. */
+	} terminal;
+
 	bool is_a_tty;
 	bool in_raw_mode;
 	struct termios orig_termios;
 	minirl_keymap_st *keymap;
 	minirl_state_st state;
+	struct input_buffer input;
+	struct display display;  /* The line as it is about to be displayed. */
+	struct display shadow;   /* The line as it was last displayed. */
+	struct layout layout;
+	struct buffer output;    /* Output queued to be written in one go. */
+	struct buffer echo_mask; /* Echo chars displayed in place of the line. */
+
+	minirl_options_st options;
+
+	struct history history;
+	struct buffer history_scratch; /* The line being entered while browsing the history. */
+	struct {
+		struct buffer query;
+		struct buffer prompt;
+		struct buffer line;     /* The line to restore if the search is cancelled. */
+	} search;
 
+	/* The line returned by minirl_readline_view() or the non-blocking API. */
+	struct buffer line;
+
+	/* A line being read with minirl_readline_start() and minirl_feed(). */
+	struct {
+		bool active;
+		bool edit;              /* Edit the line, rather than just read it. */
+		struct buffer prompt;
+		struct buffer backlog;  /* Fed input left over once the line was complete. */
+	} nonblocking;
+
+	/* Input read when it isn't from a terminal. */
 	struct {
-		bool mask_mode;
-		bool force_isatty;
-		echo_st echo;
-	} options;
+		struct buffer input;
+		size_t next;            /* The start of the input not yet returned. */
+	} no_tty;
+
+	/*
+	 * The last completion from an index, which is narrowed down by the
+	 * next one if its word starts with the same prefix.
+	 */
+	struct {
+		minirl_completion_index_st *index;
+		struct buffer prefix;
+		struct completion_range range;
+		struct buffer listing;  /* Matches waiting for the user to ask for them. */
+	} completion;
 
+	/* A completion started by minirl_complete_async(). */
+	struct {
+		unsigned long token;    /* The pending request, 0 if none. */
+		unsigned long last_token;
+		unsigned start;
+		size_t pos;
+		struct buffer line;     /* The line when the request was started. */
+		/* The latest matches, which may be delivered by any thread. */
+		struct completion_delivery *delivered;
+	} async_completion;
+	struct print_queue print_queue; /* Messages from minirl_async_print(). */
+
+	/* Counts kept once enabled with minirl_stats_enable(). */
+	struct {
+		bool enabled;
+		minirl_stats_st counts;
+		uint64_t reads_base;    /* input.reads when the counts were reset. */
+	} stats;
+	struct recorder recorder;       /* Input recorded by minirl_record_start(). */
+	struct replay replay;           /* The recording played by minirl_replay_new(). */
+#ifdef ENABLE_TRACE
 	struct {
-		size_t max_len;
-		size_t current_len;
-		char **history;
-	} history;
+		minirl_trace_key_cb key;
+		void *key_ctx;
+	} trace;
+#endif
+	struct wakeup wakeup;
 };
 
@@ -0,0 +1,138 @@
+#include "recording.h"
+#include "export.h"
+#include "io.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/* Events are written once this much is waiting. */
+#define RECORDER_FLUSH_SIZE 4096
+
+static uint64_t
+recorder_now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static void
+recorder_flush(struct recorder * const rec)
+{
+	char const *p = rec->events.b;
+	size_t left = rec->events.len;
+
+	while (left > 0) {
+		ssize_t const written = io_write(rec->fd, p, left);
+
+		if (written <= 0) {
+			rec->failed = true;
+			break;
+		}
+		p += written;
+		left -= written;
+	}
+	buffer_reset(&rec->events);
+}
+
+static void
+recorder_event_add(
+	struct recorder * const rec,
+	uint8_t const type,
+	uint32_t const value,
+	char const * const bytes,
+	size_t const len)
+{
+	uint64_t const time_us = (recorder_now_ns() - rec->start_ns) / 1000;
+	uint8_t event[RECORDING_EVENT_SIZE];
+
+	event[0] = type;
+	for (size_t i = 0; i < 8; i++) {
+		event[1 + i] = time_us >> (8 * i);
+	}
+	for (size_t i = 0; i < 4; i++) {
+		event[9 + i] = value >> (8 * i);
+	}
+	if (!buffer_append(&rec->events, (char const *)event, sizeof event)
+	    || (len > 0 && !buffer_append(&rec->events, bytes, len))) {
+		rec->failed = true;
+	}
+	if (rec->events.len >= RECORDER_FLUSH_SIZE) {
+		recorder_flush(rec);
+	}
+}
+
+NO_EXPORT
+void
+recorder_init(struct recorder * const rec, struct allocator const * const alloc)
+{
+	rec->fd = -1;
+	rec->failed = false;
+	rec->start_ns = 0;
+	rec->width = 0;
+	rec->events = (struct buffer){ .alloc = alloc };
+}
+
+NO_EXPORT
+bool
+recorder_open(struct recorder * const rec, char const * const filename)
+{
+	if (recorder_active(rec)) {
+		recorder_close(rec);
+	}
+
+	int const fd = open(filename, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+
+	if (fd == -1) {
+		return false;
+	}
+	rec->fd = fd;
+	rec->failed = false;
+	rec->start_ns = recorder_now_ns();
+	rec->width = 0;
+	buffer_reset(&rec->events);
+	if (!buffer_append(&rec->events, RECORDING_HEADER, strlen(RECORDING_HEADER))) {
+		rec->failed = true;
+	}
+
+	return true;
+}
+
+NO_EXPORT
+bool
+recorder_close(struct recorder * const rec)
+{
+	if (!recorder_active(rec)) {
+		return false;
+	}
+	recorder_flush(rec);
+	if (close(rec->fd) == -1 && errno != EINTR) {
+		rec->failed = true;
+	}
+	rec->fd = -1;
+	buffer_clear(&rec->events);
+
+	return !rec->failed;
+}
+
+NO_EXPORT
+void
+recorder_input(struct recorder * const rec, char const * const bytes, size_t const len)
+{
+	recorder_event_add(rec, RECORDING_EVENT_INPUT, len, bytes, len);
+}
+
+NO_EXPORT
+void
+recorder_width(struct recorder * const rec, int const width)
+{
+	if (width != rec->width) {
+		rec->width = width;
+		recorder_event_add(rec, RECORDING_EVENT_WIDTH, width, NULL, 0);
+	}
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "alloc.h"
+#include "buffer.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * The format of a recording, as described for minirl_record_start(): a
+ * header line, then events of a type byte, a 64 bit time in microseconds and
+ * a 32 bit value, little endian, with an input event followed by its bytes.
+ */
+#define RECORDING_HEADER "minirl recording 1\n"
+#define RECORDING_EVENT_SIZE 13
+#define RECORDING_EVENT_INPUT 'i'
+#define RECORDING_EVENT_WIDTH 'w'
+
+/*
+ * Records the input an instance reads, and the terminal widths it sees, to
+ * a file. Events are kept in memory and written in blocks.
+ */
+struct recorder {
+	int fd;                 /* -1 if not recording. */
+	bool failed;            /* An event couldn't be recorded. */
+	uint64_t start_ns;
+	int width;              /* The last width recorded, 0 if none. */
+	struct buffer events;   /* Events not yet written to the file. */
+};
+
+void
+recorder_init(struct recorder *rec, struct allocator const *alloc);
+
+/*
+ * Start recording to a new file, replacing any existing one.
+ * Return true if successful, else false.
+ */
+bool
+recorder_open(struct recorder *rec, char const *filename);
+
+/*
+ * Write the remaining events and close the file.
+ * Return true if every event was recorded, else false.
+ */
+bool
+recorder_close(struct recorder *rec);
+
+static inline bool
+recorder_active(struct recorder const * const rec)
+{
+	return rec->fd >= 0;
+}
+
+void
+recorder_input(struct recorder *rec, char const *bytes, size_t len);
+
+/* Record the terminal width, if it has changed. */
+void
+recorder_width(struct recorder *rec, int width);
+
+/*
+ * Decode the event header at 'p'.
+ * Inline so that minirl_bench can read recordings too.
+ */
+static inline void
+recording_event_decode(
+	uint8_t const * const p,
+	uint8_t * const type,
+	uint64_t * const time_us,
+	uint32_t * const value)
+{
+	*type = p[0];
+	*time_us = 0;
+	for (size_t i = 0; i < 8; i++) {
+		*time_us |= (uint64_t)p[1 + i] << (8 * i);
+	}
+	*value = 0;
+	for (size_t i = 0; i < 4; i++) {
+		*value |= (uint32_t)p[9 + i] << (8 * i);
+	}
+}
@@ -0,0 +1,231 @@
+#include "replay.h"
+#include "export.h"
+#include "io.h"
+#include "recording.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+static uint64_t
+replay_now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+/*
+ * Move on to the next input event, applying any width events before it.
+ * Return false at the end of the recording, or if it is malformed.
+ */
+static bool
+replay_input_next(struct replay * const replay)
+{
+	struct buffer const * const recording = &replay->recording;
+
+	while (replay->input_left == 0) {
+		if (recording->len - replay->next < RECORDING_EVENT_SIZE) {
+			return false;
+		}
+
+		uint8_t type;
+		uint64_t time_us;
+		uint32_t value;
+
+		recording_event_decode((uint8_t const *)recording->b + replay->next,
+				       &type,
+				       &time_us,
+				       &value);
+		replay->next += RECORDING_EVENT_SIZE;
+
+		switch (type) {
+		case RECORDING_EVENT_INPUT:
+			if (recording->len - replay->next < value) {
+				return false;
+			}
+			replay->input_left = value;
+			replay->input_time_us = time_us;
+			break;
+
+		case RECORDING_EVENT_WIDTH:
+			replay->resized = replay->resized || (int)value != replay->width;
+			replay->width = value;
+			break;
+
+		default:
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/*
+ * When pacing, wait until the current input event is due.
+ * Return false if it isn't due and 'wait' is false.
+ */
+static bool
+replay_input_due(struct replay * const replay, bool const wait)
+{
+	if (!replay->paced) {
+		return true;
+	}
+
+	uint64_t const due_ns = replay->start_ns + replay->input_time_us * 1000;
+	uint64_t now_ns = replay_now_ns();
+
+	if (now_ns >= due_ns) {
+		return true;
+	}
+	if (!wait) {
+		return false;
+	}
+	while (now_ns < due_ns) {
+		uint64_t const delay_ns = due_ns - now_ns;
+		struct timespec const delay = {
+			.tv_sec = delay_ns / 1000000000,
+			.tv_nsec = delay_ns % 1000000000
+		};
+
+		nanosleep(&delay, NULL);
+		now_ns = replay_now_ns();
+	}
+
+	return true;
+}
+
+static ssize_t
+replay_read(void * const ctx, struct iovec const * const iov, int const iov_count, bool const wait)
+{
+	struct replay * const replay = ctx;
+
+	if (!replay_input_next(replay)) {
+		return -1;
+	}
+	if (!replay_input_due(replay, wait)) {
+		return 0;
+	}
+
+	/* Return what a single read at the time would have. */
+	ssize_t nread = 0;
+
+	for (int i = 0; i < iov_count && replay->input_left > 0; i++) {
+		size_t const len =
+			(iov[i].iov_len < replay->input_left) ? iov[i].iov_len : replay->input_left;
+
+		memcpy(iov[i].iov_base, replay->recording.b + replay->next, len);
+		replay->next += len;
+		replay->input_left -= len;
+		nread += len;
+	}
+
+	return nread;
+}
+
+static bool
+replay_write(void * const ctx, struct iovec const * const iov, int const iov_count)
+{
+	(void)ctx;
+	(void)iov;
+	(void)iov_count;
+
+	return true;
+}
+
+static int
+replay_width(void * const ctx)
+{
+	struct replay const * const replay = ctx;
+
+	return replay->width;
+}
+
+NO_EXPORT
+minirl_io_st const replay_io = {
+	.read = replay_read,
+	.write = replay_write,
+	.width = replay_width
+};
+
+NO_EXPORT
+void
+replay_init(struct replay * const replay, struct allocator const * const alloc)
+{
+	memset(replay, 0, sizeof *replay);
+	replay->recording.alloc = alloc;
+}
+
+NO_EXPORT
+bool
+replay_open(struct replay * const replay, char const * const filename, bool const paced)
+{
+	bool success = false;
+	struct buffer * const recording = &replay->recording;
+	int const fd = open(filename, O_RDONLY | O_CLOEXEC);
+	struct stat st;
+
+	if (fd == -1) {
+		goto done;
+	}
+	if (fstat(fd, &st) == -1 || !buffer_init(recording, st.st_size)) {
+		goto done;
+	}
+	while (recording->len < (size_t)st.st_size) {
+		ssize_t const nread =
+			io_read(fd, recording->b + recording->len, st.st_size - recording->len);
+
+		if (nread <= 0) {
+			goto done;
+		}
+		recording->len += nread;
+	}
+
+	size_t const header_len = strlen(RECORDING_HEADER);
+
+	if (recording->len < header_len
+	    || memcmp(recording->b, RECORDING_HEADER, header_len) != 0) {
+		goto done;
+	}
+	replay->next = header_len;
+	replay->input_left = 0;
+	replay->paced = paced;
+	replay->start_ns = replay_now_ns();
+	/* Any width recorded before the first input is the initial width. */
+	replay_input_next(replay);
+	replay->resized = false;
+	success = true;
+
+done:
+	if (fd != -1) {
+		close(fd);
+	}
+	if (!success) {
+		buffer_clear(recording);
+	}
+
+	return success;
+}
+
+NO_EXPORT
+void
+replay_free(struct replay * const replay)
+{
+	buffer_clear(&replay->recording);
+}
+
+NO_EXPORT
+bool
+replay_resized(struct replay * const replay)
+{
+	bool const resized = replay->resized;
+
+	replay->resized = false;
+
+	return resized;
+}
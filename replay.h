@@ -0,0 +1,44 @@
+#pragma once
+
+#include "alloc.h"
+#include "buffer.h"
+#include "minirl.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Plays a recording back as the input of an instance, using the replay_io
+ * callbacks. The terminal width is taken from the recording, and the output
+ * is discarded.
+ */
+struct replay {
+	struct buffer recording;
+	size_t next;            /* Offset of the next event, or input byte. */
+	size_t input_left;      /* Bytes of the current input event still to read. */
+	uint64_t input_time_us; /* When the current input event was recorded. */
+	bool paced;             /* Wait until each event is due, as recorded. */
+	uint64_t start_ns;
+	int width;
+	bool resized;           /* The width has changed since last checked. */
+};
+
+extern minirl_io_st const replay_io;
+
+void
+replay_init(struct replay *replay, struct allocator const *alloc);
+
+/*
+ * Load a recording to play back.
+ * Return true if successful, else false.
+ */
+bool
+replay_open(struct replay *replay, char const *filename, bool paced);
+
+void
+replay_free(struct replay *replay);
+
+/* Return true if the width has changed since this was last called. */
+bool
+replay_resized(struct replay *replay);
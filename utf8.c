@@ -4,23 +4,6 @@
 #include <stdbool.h>
 #include <stdlib.h>
 
-enum {
-	UTF8_GRAPHEME_BREAK_OTHER,
-	UTF8_GRAPHEME_BREAK_CR,
-	UTF8_GRAPHEME_BREAK_LF,
-	UTF8_GRAPHEME_BREAK_CONTROL,
-	UTF8_GRAPHEME_BREAK_EXTEND,
-	UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR,
-	UTF8_GRAPHEME_BREAK_PREPEND,
-	UTF8_GRAPHEME_BREAK_SPACINGMARK,
-	UTF8_GRAPHEME_BREAK_L,
-	UTF8_GRAPHEME_BREAK_V,
-	UTF8_GRAPHEME_BREAK_T,
-	UTF8_GRAPHEME_BREAK_LV,
-	UTF8_GRAPHEME_BREAK_LVT,
-	UTF8_GRAPHEME_BREAK_ZWJ,
-};
-
 #include "utf8data.c"
 
 static bool utf8_cont(char c)
@@ -28,6 +11,19 @@ static bool utf8_cont(char c)
 	return (c & 0xc0) == 0x80;
 }
 
+/*
+ * Whether the chars at 'point' and 'point' + 1 are both ASCII and so in
+ * different graphemes, which is true of all pairs but CR LF.
+ */
+static bool utf8_ascii_break(const char *s, size_t len, size_t point)
+{
+	if (point + 1 >= len)
+		return (s[point] & 0x80) == 0;
+	if (((s[point] | s[point + 1]) & 0x80) != 0)
+		return false;
+	return s[point] != '\r' || s[point + 1] != '\n';
+}
+
 NO_EXPORT
 size_t utf8_char_len(char c)
 {
@@ -151,38 +147,35 @@ size_t utf8_char_prev(const char *s, size_t len, size_t point)
 	}
 }
 
-NO_EXPORT
-size_t utf8_char_width(const char *s, size_t len, size_t point)
+/* Get the width and grapheme break class of a codepoint, packed together. */
+static uint8_t utf8_props(uint32_t c)
 {
-	uint32_t c;
-	uint8_t i;
-
-	utf8_char_decode(s + point, len - point, &c);
 	if (c >= 0x110000)
 		return 0;
-	i = width0[c >> width0_shift];
-	i = width1[i][(c >> width1_shift) & width1_mask];
-	i = width2[i][(c >> width2_shift) & width2_mask];
-	return (i >> ((c & width3_mask) * width_val_shift)) & width_val_mask;
+	return unicode_props[unicode_props_index[c >> unicode_props_shift]][c & unicode_props_mask];
 }
 
-static int utf8_grapheme_boundary_class(uint32_t c)
+static size_t utf8_props_width(uint8_t props)
 {
-	uint8_t i;
+	return props & unicode_props_width_mask;
+}
 
-	i = grapheme_break0[c >> grapheme_break0_shift];
-	i = grapheme_break1[i][(c >> grapheme_break1_shift) & grapheme_break1_mask];
-	i = grapheme_break2[i][(c >> grapheme_break2_shift) & grapheme_break2_mask];
-	return (i >> ((c & grapheme_break3_mask) * grapheme_break_val_shift)) & grapheme_break_val_mask;
+static int utf8_props_break_class(uint8_t props)
+{
+	return props >> unicode_props_break_shift;
 }
 
-static bool utf8_grapheme_break(uint32_t c1, uint32_t c2)
+NO_EXPORT
+size_t utf8_char_width(const char *s, size_t len, size_t point)
 {
-	int b1, b2;
+	uint32_t c;
 
-	b1 = utf8_grapheme_boundary_class(c1);
-	b2 = utf8_grapheme_boundary_class(c2);
+	utf8_char_decode(s + point, len - point, &c);
+	return utf8_props_width(utf8_props(c));
+}
 
+static bool utf8_grapheme_break(int b1, int b2)
+{
 	/* GB3 */
 	if (b1 == UTF8_GRAPHEME_BREAK_CR && b2 == UTF8_GRAPHEME_BREAK_LF)
 		return false;
@@ -227,40 +220,66 @@ static bool utf8_grapheme_break(uint32_t c1, uint32_t c2)
 	return true;
 }
 
-NO_EXPORT
-size_t utf8_grapheme_next(const char *s, size_t len, size_t point)
+/*
+ * Find the end of the grapheme at 'point', adding up the widths of its chars
+ * along the way if 'width' isn't NULL. Each char is decoded and looked up once.
+ */
+static size_t utf8_grapheme_scan(const char *s, size_t len, size_t point, size_t *width)
 {
-	uint32_t c1, c2;
+	uint32_t c;
+	uint8_t p1, p2;
 
-	utf8_char_decode(s + point, len - point, &c1);
+	utf8_char_decode(s + point, len - point, &c);
+	p1 = utf8_props(c);
 	for (;;) {
+		if (width)
+			*width += utf8_props_width(p1);
 		point = utf8_char_next(s, len, point);
 		if (point >= len)
 			return point;
-		utf8_char_decode(s + point, len - point, &c2);
-		if (utf8_grapheme_break(c1, c2))
+		utf8_char_decode(s + point, len - point, &c);
+		p2 = utf8_props(c);
+		if (utf8_grapheme_break(utf8_props_break_class(p1), utf8_props_break_class(p2)))
 			return point;
-		c1 = c2;
+		p1 = p2;
 	}
 }
 
+NO_EXPORT
+size_t utf8_grapheme_next(const char *s, size_t len, size_t point)
+{
+	/* Most text is ASCII, which doesn't need the tables. */
+	if (utf8_ascii_break(s, len, point))
+		return point + 1;
+
+	return utf8_grapheme_scan(s, len, point, NULL);
+}
+
 NO_EXPORT
 size_t utf8_grapheme_prev(const char *s, size_t len, size_t point)
 {
 	uint32_t c1, c2;
+	int b1, b2;
 	size_t prev;
 
+	if (point == 1 && (s[0] & 0x80) == 0)
+		return 0;
+	if (point >= 2 && utf8_ascii_break(s, len, point - 2))
+		return point - 1;
+
 	point = utf8_char_prev(s, len, point);
 	utf8_char_decode(s + point, len - point, &c2);
+	b2 = utf8_props_break_class(utf8_props(c2));
 	for (;;) {
 		if (point == 0)
 			return point;
 		prev = utf8_char_prev(s, len, point);
 		utf8_char_decode(s + prev, len - prev, &c1);
-		if (utf8_grapheme_break(c1, c2))
+		b1 = utf8_props_break_class(utf8_props(c1));
+		if (utf8_grapheme_break(b1, b2))
 			return point;
 		point = prev;
-		c2 = c1;
+		b2 = b1;
 	}
 }
 
@@ -269,14 +288,16 @@ size_t utf8_grapheme_width(const char *s, size_t len, size_t point, size_t *pnex
 {
 	size_t next;
 	size_t width;
-	size_t i;
 
-	next = utf8_grapheme_next(s, len, point);
-	if (pnext) *pnext = next;
+	/* A printable ASCII char on its own takes up one column. */
+	if (s[point] >= ' ' && s[point] <= '~' && utf8_ascii_break(s, len, point)) {
+		if (pnext) *pnext = point + 1;
+		return 1;
+	}
 
 	width = 0;
-	for (i = point; i < next; i = utf8_char_next(s, len, i))
-		width += utf8_char_width(s, len, i);
+	next = utf8_grapheme_scan(s, len, point, &width);
+	if (pnext) *pnext = next;
 	return width;
 }
 
@@ -1,3561 +1,2239 @@
-static const uint8_t width2[][8] = {
-	{
-		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
-	},
-	{
-		0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x15, 0x00, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x01, 0x00, 0x00, 0x00,
-	},
-	{
-		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-	},
-	{
-		0x41, 0x10, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x00, 0x50, 0x55, 0x55, 0x00, 0x00, 0x40, 0x54,
-	},
-	{
-		0x55, 0x55, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x54, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x10,
-	},
-	{
-		0x00, 0x14, 0x04, 0x50, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x15, 0x51, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00,
-	},
-	{
-		0x00, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x05, 0x00, 0x00, 0x54, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x15, 0x00, 0x00, 0x55, 0x55, 0x51,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x10, 0x00,
-	},
-	{
-		0x00, 0x01, 0x01, 0x50, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x50, 0x55, 0x00, 0x00,
-	},
-	{
-		0x55, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-	},
-	{
-		0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x54,
-	},
-	{
-		0x01, 0x00, 0x54, 0x51, 0x01, 0x00, 0x55, 0x55,
-	},
-	{
-		0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54,
-	},
-	{
-		0x01, 0x54, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45,
-	},
-	{
-		0x41, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x41, 0x15, 0x14, 0x50, 0x51, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x50, 0x51, 0x55, 0x55,
-	},
-	{
-		0x01, 0x10, 0x54, 0x51, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x14,
-	},
-	{
-		0x01, 0x54, 0x55, 0x51, 0x55, 0x41, 0x55, 0x55,
-	},
-	{
-		0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x54, 0x55, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x54, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x04,
-	},
-	{
-		0x54, 0x05, 0x04, 0x50, 0x55, 0x41, 0x55, 0x55,
-	},
-	{
-		0x55, 0x45, 0x55, 0x50, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x54,
-	},
-	{
-		0x55, 0x55, 0x45, 0x55, 0x05, 0x44, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x51, 0x00, 0x40, 0x55,
-	},
-	{
-		0x55, 0x15, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x51, 0x00, 0x00, 0x54,
-	},
-	{
-		0x55, 0x55, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x11, 0x51, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x01, 0x00, 0x00, 0x40,
-	},
-	{
-		0x00, 0x04, 0x55, 0x01, 0x00, 0x00, 0x01, 0x00,
-	},
-	{
-		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54,
-	},
-	{
-		0x55, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x01, 0x04, 0x00, 0x41, 0x41,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05,
-	},
-	{
-		0x54, 0x55, 0x55, 0x55, 0x01, 0x54, 0x55, 0x55,
-	},
-	{
-		0x45, 0x41, 0x55, 0x51, 0x55, 0x55, 0x55, 0x51,
-	},
-	{
-		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x05, 0x54, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x10, 0x00, 0x50,
-	},
-	{
-		0x55, 0x45, 0x01, 0x00, 0x00, 0x55, 0x55, 0x51,
-	},
-	{
-		0x55, 0x55, 0x15, 0x00, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x41, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x40, 0x15, 0x54, 0x55, 0x45, 0x55, 0x01, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x14, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x00, 0x40,
-	},
-	{
-		0x44, 0x01, 0x00, 0x54, 0x15, 0x00, 0x00, 0x14,
-	},
-	{
-		0x00, 0x00, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x04, 0x40, 0x54,
-	},
-	{
-		0x55, 0x55, 0x15, 0x00, 0x00, 0x55, 0x55, 0x55,
-	},
-	{
-		0x05, 0x50, 0x10, 0x50, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x45, 0x50, 0x11, 0x50, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x00, 0x00, 0x05, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00,
-	},
-	{
-		0x04, 0x00, 0x54, 0x51, 0x55, 0x54, 0x50, 0x55,
-	},
-	{
-		0x55, 0x55, 0x05, 0x40, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x00, 0x04, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x00, 0x00, 0x00, 0x00, 0x54, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0x55,
-	},
-	{
-		0x55, 0x55, 0x69, 0x55, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0xA9, 0x56, 0x96, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x69,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x5A, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x95, 0x55, 0x55, 0x55,
-	},
-	{
-		0x59, 0x55, 0xA5, 0x55, 0x55, 0x55, 0x55, 0x69,
-	},
-	{
-		0x55, 0x5A, 0x55, 0x65, 0x55, 0x56, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x65, 0x55, 0xA5, 0x59, 0x65, 0x59,
-	},
-	{
-		0x55, 0x59, 0xA5, 0x55, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x66, 0x95, 0x9A, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0xA9, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x95,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x56,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x56, 0x59, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x15, 0x50, 0x55, 0x55, 0x55,
-	},
-	{
-		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9A, 0xAA,
-	},
-	{
-		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55,
-	},
-	{
-		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x5A, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0x55,
-	},
-	{
-		0xAA, 0xAA, 0x0A, 0xA0, 0xAA, 0xAA, 0xAA, 0x6A,
-	},
-	{
-		0xA9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
-	},
-	{
-		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x6A, 0x81, 0xAA,
-	},
-	{
-		0x55, 0xA9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
-	},
-	{
-		0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xAA, 0xAA, 0xAA,
-	},
-	{
-		0xAA, 0xAA, 0xAA, 0x6A, 0xAA, 0xAA, 0xAA, 0xAA,
-	},
-	{
-		0xAA, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA,
-	},
-	{
-		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x6A,
-	},
-	{
-		0xAA, 0xAA, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA,
-	},
-	{
-		0xAA, 0xAA, 0xAA, 0x56, 0xAA, 0xAA, 0xAA, 0xAA,
-	},
-	{
-		0xAA, 0x6A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x15, 0x40, 0x00, 0x00, 0x50,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x50, 0x55, 0x55, 0x55,
-	},
-	{
-		0x45, 0x45, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x41, 0x55, 0x54, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x00, 0x00, 0x00, 0x00, 0x50, 0x55, 0x55, 0x15,
-	},
-	{
-		0x55, 0x05, 0x00, 0x50, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x15, 0x00, 0x00, 0x50, 0x55, 0x55, 0x55,
-	},
-	{
-		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x56,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x15, 0x05, 0x50, 0x50,
-	},
-	{
-		0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x01, 0x40, 0x41, 0x41, 0x55, 0x55,
-	},
-	{
-		0x15, 0x55, 0x55, 0x54, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x04, 0x14, 0x54, 0x05,
-	},
-	{
-		0x55, 0x55, 0x55, 0x50, 0x55, 0x45, 0x55, 0x55,
-	},
-	{
-		0x55, 0x51, 0x54, 0x51, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45,
-	},
-	{
-		0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0x5A, 0x55,
-	},
-	{
-		0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xAA,
-	},
-	{
-		0xAA, 0xAA, 0xAA, 0xAA, 0x6A, 0xAA, 0xAA, 0xAA,
-	},
-	{
-		0xAA, 0x6A, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0xAA, 0x6A, 0x55, 0x55, 0x55, 0x55, 0x01, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51,
-	},
-	{
-		0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x40, 0x55,
-	},
-	{
-		0x01, 0x41, 0x55, 0x00, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x40, 0x15,
-	},
-	{
-		0x55, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x15, 0x54, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x05, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00,
-	},
-	{
-		0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x14, 0x54, 0x55, 0x15,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x15, 0x40, 0x41, 0x51,
-	},
-	{
-		0x45, 0x55, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x15, 0x00, 0x01, 0x00, 0x54, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x40,
-	},
-	{
-		0x55, 0x55, 0x01, 0x14, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x15, 0x50, 0x04, 0x55, 0x45,
-	},
-	{
-		0x15, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x05, 0x00, 0x54, 0x00, 0x54, 0x55, 0x55,
-	},
-	{
-		0x05, 0x44, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x44, 0x15,
-	},
-	{
-		0x04, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x05, 0x50, 0x55, 0x10,
-	},
-	{
-		0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x40, 0x11,
-	},
-	{
-		0x55, 0x55, 0x15, 0x51, 0x00, 0x10, 0x55, 0x55,
-	},
-	{
-		0x05, 0x10, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x15, 0x00, 0x00, 0x41, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x44,
-	},
-	{
-		0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x05, 0x55,
-	},
-	{
-		0x01, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x14, 0x40,
-	},
-	{
-		0x55, 0x15, 0x55, 0x55, 0x01, 0x40, 0x01, 0x55,
-	},
-	{
-		0x55, 0x55, 0x05, 0x00, 0x00, 0x40, 0x50, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x00, 0x40, 0x00, 0x10,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x00, 0x00,
-	},
-	{
-		0x00, 0x00, 0x05, 0x00, 0x04, 0x41, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x01, 0x40, 0x45, 0x10,
-	},
-	{
-		0x00, 0x10, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x50, 0x11, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x15, 0x54, 0x55, 0x55,
-	},
-	{
-		0x44, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x54, 0x15, 0x00, 0x00, 0x00, 0x50, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x00, 0x54, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x00, 0x40, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x15, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x15, 0x40, 0x55, 0x55, 0x55,
-	},
-	{
-		0xAA, 0x54, 0x55, 0x55, 0x5A, 0x55, 0x55, 0x55,
-	},
-	{
-		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55,
-	},
-	{
-		0xAA, 0xAA, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0xAA, 0xA9, 0xAA, 0x69,
-	},
-	{
-		0x6A, 0x55, 0x55, 0x55, 0x65, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x6A, 0x59, 0x55, 0x55,
-	},
-	{
-		0x55, 0xAA, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA,
-	},
-	{
-		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x41,
-	},
-	{
-		0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-	},
-	{
-		0x55, 0x15, 0x50, 0x55, 0x15, 0x00, 0x00, 0x00,
-	},
-	{
-		0x40, 0x01, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x05, 0x50, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x05, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x15, 0x00,
-	},
-	{
-		0x00, 0x00, 0x00, 0x54, 0x55, 0x51, 0x55, 0x55,
-	},
-	{
-		0x55, 0x54, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00,
-	},
-	{
-		0x01, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-	},
-	{
-		0x10, 0x04, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x45, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x00, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x95, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x65, 0xA9, 0xAA, 0x6A, 0x55,
-	},
-	{
-		0x6A, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA,
-	},
-	{
-		0xAA, 0xAA, 0x56, 0x55, 0x5A, 0x55, 0x55, 0x55,
-	},
-	{
-		0xAA, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0x56, 0x55, 0x55, 0xA9, 0xAA, 0x9A, 0xAA, 0xAA,
-	},
-	{
-		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA6,
-	},
-	{
-		0xAA, 0xAA, 0x6A, 0x95, 0xAA, 0x55, 0x55, 0x55,
-	},
-	{
-		0xAA, 0xAA, 0xAA, 0xAA, 0x56, 0x56, 0xAA, 0xAA,
-	},
-	{
-		0xA6, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
-	},
-	{
-		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x96,
-	},
-	{
-		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x5A,
-	},
-	{
-		0x55, 0x55, 0x95, 0x6A, 0xAA, 0xAA, 0xAA, 0xAA,
-	},
-	{
-		0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x65, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x69, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xAA,
-	},
-	{
-		0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55,
-	},
-	{
-		0xAA, 0x5A, 0x55, 0x56, 0x6A, 0xA9, 0x55, 0xAA,
-	},
-	{
-		0x55, 0x55, 0x95, 0x56, 0x55, 0xAA, 0xAA, 0x56,
-	},
-	{
-		0xAA, 0xAA, 0xAA, 0x55, 0x56, 0x55, 0x55, 0x55,
-	},
-	{
-		0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
-	},
-	{
-		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x6A, 0xAA,
-	},
-	{
-		0xAA, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
-	},
-	{
-		0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0x56,
-	},
-	{
-		0xAA, 0xAA, 0x56, 0x55, 0xAA, 0xAA, 0xAA, 0xAA,
-	},
-	{
-		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9A,
-	},
-	{
-		0xAA, 0x5A, 0x55, 0xA5, 0xAA, 0xAA, 0xAA, 0x55,
-	},
-	{
-		0xAA, 0xAA, 0x56, 0x55, 0xAA, 0xAA, 0x56, 0x55,
-	},
-};
-
-static const uint8_t width1[][32] = {
-	{
-		0, 1, 1, 2, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-		1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 3, 1, 1, 1, 1,
-	},
-	{
-		1, 1, 1, 1, 4, 1, 1, 1, 1, 1, 1, 1, 5, 6, 7, 1,
-		8, 1, 9, 10, 1, 1, 11, 12, 13, 14, 15, 1, 1, 16, 1, 17,
-	},
-	{
-		18, 19, 20, 1, 21, 1, 22, 0, 23, 24, 25, 26, 27, 28, 29, 30,
-		31, 28, 32, 33, 31, 28, 34, 35, 27, 36, 37, 26, 38, 1, 39, 1,
-	},
-	{
-		40, 41, 42, 26, 27, 36, 43, 26, 44, 45, 29, 26, 27, 1, 46, 1,
-		1, 47, 48, 1, 1, 49, 50, 1, 51, 52, 1, 53, 54, 55, 56, 1,
-	},
-	{
-		1, 57, 58, 59, 60, 1, 1, 1, 61, 61, 61, 1, 1, 1, 1, 1,
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 62, 1, 1, 1, 1, 1,
-	},
-	{
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-		1, 1, 1, 1, 1, 1, 1, 1, 63, 64, 64, 64, 1, 65, 66, 1,
-	},
-	{
-		67, 1, 1, 1, 68, 69, 1, 1, 1, 70, 1, 1, 1, 1, 1, 1,
-		71, 1, 72, 73, 1, 14, 74, 1, 75, 76, 38, 77, 44, 78, 1, 79,
-	},
-	{
-		1, 80, 1, 1, 1, 1, 81, 82, 1, 1, 1, 1, 1, 1, 0, 0,
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-	},
-	{
-		67, 83, 1, 84, 1, 1, 14, 85, 1, 1, 1, 1, 1, 1, 1, 1,
-		1, 1, 1, 1, 1, 1, 1, 1, 86, 87, 1, 1, 1, 1, 1, 88,
-	},
-	{
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 89,
-		90, 1, 91, 92, 93, 94, 95, 96, 97, 98, 99, 1, 100, 101, 1, 1,
-	},
-	{
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-		1, 1, 1, 1, 1, 1, 1, 1, 102, 1, 103, 1, 1, 1, 1, 1,
-	},
-	{
-		1, 1, 1, 1, 1, 1, 1, 104, 1, 1, 1, 2, 1, 1, 1, 0,
-		1, 1, 1, 1, 105, 61, 61, 106, 61, 61, 61, 61, 61, 61, 107, 108,
-	},
-	{
-		61, 109, 110, 61, 111, 61, 61, 61, 112, 113, 61, 61, 114, 61, 61, 115,
-		116, 61, 117, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
-	},
-	{
-		61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
-		61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
-	},
-	{
-		61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 1, 1,
-		61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
-	},
-	{
-		61, 61, 61, 61, 118, 61, 119, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-		1, 1, 1, 120, 121, 1, 1, 122, 1, 1, 1, 1, 1, 1, 1, 1,
-	},
-	{
-		123, 124, 1, 1, 1, 1, 125, 126, 1, 127, 128, 129, 23, 130, 1, 131,
-		1, 132, 133, 28, 1, 134, 27, 135, 1, 1, 1, 1, 1, 1, 1, 136,
-	},
-	{
-		61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
-		61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 137, 1, 1,
-	},
-	{
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-	},
-	{
-		1, 1, 1, 1, 1, 1, 1, 1, 61, 61, 61, 61, 61, 61, 61, 61,
-		61, 61, 61, 61, 61, 61, 61, 61, 138, 1, 1, 1, 1, 1, 1, 1,
-	},
-	{
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-		139, 140, 141, 142, 1, 1, 1, 2, 110, 61, 61, 143, 1, 1, 1, 144,
-	},
-	{
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 145,
-		1, 1, 1, 1, 1, 1, 1, 146, 1, 1, 1, 147, 1, 1, 1, 1,
-	},
-	{
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-		148, 149, 1, 1, 1, 1, 1, 68, 1, 1, 1, 1, 1, 1, 1, 1,
-	},
-	{
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 150, 1, 1, 1, 1, 1, 1,
-		1, 1, 1, 1, 1, 151, 1, 62, 1, 1, 16, 1, 152, 1, 1, 1,
-	},
-	{
-		27, 153, 154, 155, 44, 156, 157, 1, 23, 158, 1, 159, 44, 160, 161, 1,
-		1, 162, 27, 1, 1, 1, 2, 163, 44, 45, 146, 164, 1, 1, 1, 1,
-	},
-	{
-		1, 153, 165, 1, 1, 166, 167, 1, 1, 1, 1, 1, 1, 168, 169, 1,
-		1, 170, 146, 1, 1, 171, 1, 1, 62, 172, 1, 1, 1, 1, 1, 1,
-	},
-	{
-		1, 173, 1, 1, 1, 1, 1, 1, 1, 174, 175, 1, 1, 1, 176, 146,
-		177, 178, 179, 1, 180, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-	},
-	{
-		1, 181, 1, 1, 182, 183, 1, 1, 1, 184, 185, 1, 186, 1, 1, 1,
-		1, 1, 1, 1, 1, 1, 1, 187, 44, 147, 188, 1, 1, 1, 1, 1,
-	},
-	{
-		1, 14, 189, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-	},
-	{
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-		1, 1, 1, 1, 1, 1, 1, 190, 1, 191, 1, 1, 1, 1, 1, 1,
-	},
-	{
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 192, 1, 193, 1, 1, 194,
-	},
-	{
-		61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
-		61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 195,
-	},
-	{
-		61, 61, 61, 61, 61, 61, 107, 1, 196, 1, 1, 1, 1, 1, 1, 1,
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-	},
-	{
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 197,
-	},
-	{
-		61, 61, 61, 61, 61, 61, 61, 61, 61, 198, 199, 200, 61, 61, 61, 61,
-		61, 61, 61, 61, 61, 61, 61, 201, 1, 1, 1, 1, 1, 1, 1, 1,
-	},
-	{
-		1, 1, 1, 1, 202, 75, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-	},
-	{
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-		1, 1, 1, 1, 1, 1, 1, 1, 0, 203, 154, 1, 1, 1, 1, 1,
-	},
-	{
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 204, 205, 206, 1, 1,
-		1, 1, 207, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-	},
-	{
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-		0, 208, 0, 209, 210, 211, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-	},
-	{
-		212, 213, 1, 1, 192, 1, 1, 1, 1, 191, 1, 1, 1, 1, 1, 1,
-		1, 1, 1, 1, 1, 214, 1, 215, 1, 1, 1, 1, 1, 1, 1, 1,
-	},
-	{
-		1, 1, 1, 1, 1, 1, 1, 215, 1, 1, 1, 1, 1, 1, 1, 1,
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-	},
-	{
-		1, 1, 1, 1, 1, 1, 191, 1, 1, 1, 216, 1, 1, 1, 1, 1,
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-	},
-	{
-		217, 1, 1, 1, 1, 1, 218, 1, 1, 1, 1, 1, 219, 1, 1, 1,
-		220, 201, 221, 222, 1, 1, 1, 1, 61, 223, 61, 224, 106, 61, 225, 226,
-	},
-	{
-		61, 116, 227, 61, 61, 61, 61, 228, 61, 229, 230, 231, 232, 217, 1, 233,
-		61, 61, 234, 1, 61, 61, 235, 236, 1, 1, 1, 1, 1, 1, 1, 237,
-	},
-	{
-		1, 1, 1, 1, 1, 1, 1, 1, 238, 239, 240, 61, 61, 61, 61, 61,
-		1, 1, 1, 241, 242, 243, 244, 245, 1, 1, 1, 1, 1, 1, 1, 1,
-	},
-	{
-		61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
-		61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 229,
-	},
-	{
-		27, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 3,
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-	},
-};
-
-static const uint8_t width0[] = {
-	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 13, 13,
-	13, 13, 13, 14, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-	13, 13, 13, 13, 13, 13, 13, 13, 13, 15, 16, 13, 13, 13, 13, 13,
-	13, 13, 13, 13, 13, 17, 18, 18, 18, 18, 18, 18, 18, 18, 19, 20,
-	21, 18, 22, 23, 24, 25, 26, 27, 18, 18, 18, 18, 18, 28, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 29, 30, 13, 13, 13, 13,
-	13, 31, 13, 32, 18, 18, 18, 18, 18, 18, 18, 33, 34, 18, 18, 35,
-	18, 18, 18, 36, 37, 18, 38, 18, 39, 40, 41, 18, 42, 43, 44, 18,
-	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 45,
-	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
-	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 45,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	46, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
-};
+/*
+ * Generated by utf8data.py from the Unicode 15.0.0 character database.
+ * Do not edit.
+ */
 
-static const int width0_shift = 10;
-static const int width1_shift = 5;
-static const int width2_shift = 2;
-static const int width1_mask = 0x1f;
-static const int width2_mask = 0x7;
-static const int width3_mask = 0x3;
-static const int width_val_shift = 2;
-static const int width_val_mask = 0x3;
+#define UTF8DATA_UNICODE_VERSION "15.0.0"
 
-static const uint8_t grapheme_break2[][8] = {
-	{
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_LF << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CR << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_PREPEND << 0) | (UTF8_GRAPHEME_BREAK_PREPEND << 4),
-		(UTF8_GRAPHEME_BREAK_PREPEND << 0) | (UTF8_GRAPHEME_BREAK_PREPEND << 4),
-		(UTF8_GRAPHEME_BREAK_PREPEND << 0) | (UTF8_GRAPHEME_BREAK_PREPEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_PREPEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_PREPEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_PREPEND << 0) | (UTF8_GRAPHEME_BREAK_PREPEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_PREPEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_PREPEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_L << 0) | (UTF8_GRAPHEME_BREAK_L << 4),
-		(UTF8_GRAPHEME_BREAK_L << 0) | (UTF8_GRAPHEME_BREAK_L << 4),
-		(UTF8_GRAPHEME_BREAK_L << 0) | (UTF8_GRAPHEME_BREAK_L << 4),
-		(UTF8_GRAPHEME_BREAK_L << 0) | (UTF8_GRAPHEME_BREAK_L << 4),
-		(UTF8_GRAPHEME_BREAK_L << 0) | (UTF8_GRAPHEME_BREAK_L << 4),
-		(UTF8_GRAPHEME_BREAK_L << 0) | (UTF8_GRAPHEME_BREAK_L << 4),
-		(UTF8_GRAPHEME_BREAK_L << 0) | (UTF8_GRAPHEME_BREAK_L << 4),
-		(UTF8_GRAPHEME_BREAK_L << 0) | (UTF8_GRAPHEME_BREAK_L << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_V << 0) | (UTF8_GRAPHEME_BREAK_V << 4),
-		(UTF8_GRAPHEME_BREAK_V << 0) | (UTF8_GRAPHEME_BREAK_V << 4),
-		(UTF8_GRAPHEME_BREAK_V << 0) | (UTF8_GRAPHEME_BREAK_V << 4),
-		(UTF8_GRAPHEME_BREAK_V << 0) | (UTF8_GRAPHEME_BREAK_V << 4),
-		(UTF8_GRAPHEME_BREAK_V << 0) | (UTF8_GRAPHEME_BREAK_V << 4),
-		(UTF8_GRAPHEME_BREAK_V << 0) | (UTF8_GRAPHEME_BREAK_V << 4),
-		(UTF8_GRAPHEME_BREAK_V << 0) | (UTF8_GRAPHEME_BREAK_V << 4),
-		(UTF8_GRAPHEME_BREAK_V << 0) | (UTF8_GRAPHEME_BREAK_V << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_V << 0) | (UTF8_GRAPHEME_BREAK_V << 4),
-		(UTF8_GRAPHEME_BREAK_V << 0) | (UTF8_GRAPHEME_BREAK_V << 4),
-		(UTF8_GRAPHEME_BREAK_V << 0) | (UTF8_GRAPHEME_BREAK_V << 4),
-		(UTF8_GRAPHEME_BREAK_V << 0) | (UTF8_GRAPHEME_BREAK_V << 4),
-		(UTF8_GRAPHEME_BREAK_T << 0) | (UTF8_GRAPHEME_BREAK_T << 4),
-		(UTF8_GRAPHEME_BREAK_T << 0) | (UTF8_GRAPHEME_BREAK_T << 4),
-		(UTF8_GRAPHEME_BREAK_T << 0) | (UTF8_GRAPHEME_BREAK_T << 4),
-		(UTF8_GRAPHEME_BREAK_T << 0) | (UTF8_GRAPHEME_BREAK_T << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_T << 0) | (UTF8_GRAPHEME_BREAK_T << 4),
-		(UTF8_GRAPHEME_BREAK_T << 0) | (UTF8_GRAPHEME_BREAK_T << 4),
-		(UTF8_GRAPHEME_BREAK_T << 0) | (UTF8_GRAPHEME_BREAK_T << 4),
-		(UTF8_GRAPHEME_BREAK_T << 0) | (UTF8_GRAPHEME_BREAK_T << 4),
-		(UTF8_GRAPHEME_BREAK_T << 0) | (UTF8_GRAPHEME_BREAK_T << 4),
-		(UTF8_GRAPHEME_BREAK_T << 0) | (UTF8_GRAPHEME_BREAK_T << 4),
-		(UTF8_GRAPHEME_BREAK_T << 0) | (UTF8_GRAPHEME_BREAK_T << 4),
-		(UTF8_GRAPHEME_BREAK_T << 0) | (UTF8_GRAPHEME_BREAK_T << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_ZWJ << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_L << 0) | (UTF8_GRAPHEME_BREAK_L << 4),
-		(UTF8_GRAPHEME_BREAK_L << 0) | (UTF8_GRAPHEME_BREAK_L << 4),
-		(UTF8_GRAPHEME_BREAK_L << 0) | (UTF8_GRAPHEME_BREAK_L << 4),
-		(UTF8_GRAPHEME_BREAK_L << 0) | (UTF8_GRAPHEME_BREAK_L << 4),
-		(UTF8_GRAPHEME_BREAK_L << 0) | (UTF8_GRAPHEME_BREAK_L << 4),
-		(UTF8_GRAPHEME_BREAK_L << 0) | (UTF8_GRAPHEME_BREAK_L << 4),
-		(UTF8_GRAPHEME_BREAK_L << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_LV << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LV << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LV << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LV << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_LVT << 0) | (UTF8_GRAPHEME_BREAK_LVT << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_V << 0) | (UTF8_GRAPHEME_BREAK_V << 4),
-		(UTF8_GRAPHEME_BREAK_V << 0) | (UTF8_GRAPHEME_BREAK_V << 4),
-		(UTF8_GRAPHEME_BREAK_V << 0) | (UTF8_GRAPHEME_BREAK_V << 4),
-		(UTF8_GRAPHEME_BREAK_V << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_T << 4),
-		(UTF8_GRAPHEME_BREAK_T << 0) | (UTF8_GRAPHEME_BREAK_T << 4),
-		(UTF8_GRAPHEME_BREAK_T << 0) | (UTF8_GRAPHEME_BREAK_T << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_T << 0) | (UTF8_GRAPHEME_BREAK_T << 4),
-		(UTF8_GRAPHEME_BREAK_T << 0) | (UTF8_GRAPHEME_BREAK_T << 4),
-		(UTF8_GRAPHEME_BREAK_T << 0) | (UTF8_GRAPHEME_BREAK_T << 4),
-		(UTF8_GRAPHEME_BREAK_T << 0) | (UTF8_GRAPHEME_BREAK_T << 4),
-		(UTF8_GRAPHEME_BREAK_T << 0) | (UTF8_GRAPHEME_BREAK_T << 4),
-		(UTF8_GRAPHEME_BREAK_T << 0) | (UTF8_GRAPHEME_BREAK_T << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_PREPEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_PREPEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_PREPEND << 0) | (UTF8_GRAPHEME_BREAK_PREPEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_PREPEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_PREPEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_PREPEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_PREPEND << 0) | (UTF8_GRAPHEME_BREAK_PREPEND << 4),
-		(UTF8_GRAPHEME_BREAK_PREPEND << 0) | (UTF8_GRAPHEME_BREAK_PREPEND << 4),
-		(UTF8_GRAPHEME_BREAK_PREPEND << 0) | (UTF8_GRAPHEME_BREAK_PREPEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_PREPEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_PREPEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_SPACINGMARK << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_SPACINGMARK << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_CONTROL << 4),
-		(UTF8_GRAPHEME_BREAK_CONTROL << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_EXTEND << 4),
-		(UTF8_GRAPHEME_BREAK_EXTEND << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_OTHER << 0) | (UTF8_GRAPHEME_BREAK_OTHER << 4),
-		(UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 0) | (UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 4),
-		(UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 0) | (UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 4),
-		(UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 0) | (UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 4),
-		(UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 0) | (UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 4),
-		(UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 0) | (UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 4),
-	},
-	{
-		(UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 0) | (UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 4),
-		(UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 0) | (UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 4),
-		(UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 0) | (UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 4),
-		(UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 0) | (UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 4),
-		(UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 0) | (UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 4),
-		(UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 0) | (UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 4),
-		(UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 0) | (UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 4),
-		(UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 0) | (UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR << 4),
-	},
+enum {
+	UTF8_GRAPHEME_BREAK_OTHER,
+	UTF8_GRAPHEME_BREAK_CR,
+	UTF8_GRAPHEME_BREAK_LF,
+	UTF8_GRAPHEME_BREAK_CONTROL,
+	UTF8_GRAPHEME_BREAK_EXTEND,
+	UTF8_GRAPHEME_BREAK_REGIONAL_INDICATOR,
+	UTF8_GRAPHEME_BREAK_PREPEND,
+	UTF8_GRAPHEME_BREAK_SPACINGMARK,
+	UTF8_GRAPHEME_BREAK_L,
+	UTF8_GRAPHEME_BREAK_V,
+	UTF8_GRAPHEME_BREAK_T,
+	UTF8_GRAPHEME_BREAK_LV,
+	UTF8_GRAPHEME_BREAK_LVT,
+	UTF8_GRAPHEME_BREAK_ZWJ,
 };
 
-static const uint8_t grapheme_break1[][64] = {
-	{
-		0, 1, 2, 2, 2, 2, 2, 3, 1, 1, 4, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		5, 5, 5, 5, 5, 5, 5, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-	},
-	{
-		2, 2, 2, 2, 2, 2, 2, 2, 6, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 7, 5, 8, 9, 2, 2, 2,
-		10, 11, 2, 2, 12, 5, 2, 13, 2, 2, 2, 2, 2, 14, 15, 2,
-		16, 17, 2, 5, 18, 2, 2, 2, 2, 2, 19, 13, 2, 2, 12, 20,
-	},
-	{
-		2, 21, 22, 2, 2, 23, 2, 2, 2, 24, 2, 2, 25, 5, 26, 5,
-		27, 2, 2, 28, 29, 30, 31, 2, 32, 2, 2, 33, 34, 35, 31, 36,
-		37, 2, 2, 38, 39, 17, 2, 40, 37, 2, 2, 38, 41, 2, 31, 25,
-		32, 2, 2, 42, 34, 43, 31, 2, 44, 2, 2, 45, 46, 35, 2, 2,
-	},
-	{
-		47, 2, 2, 42, 48, 49, 31, 2, 32, 2, 2, 50, 51, 49, 31, 52,
-		53, 2, 2, 54, 55, 35, 31, 2, 32, 2, 2, 2, 56, 57, 2, 58,
-		2, 2, 2, 59, 60, 2, 2, 2, 2, 2, 2, 61, 62, 2, 2, 2,
-		2, 63, 2, 64, 2, 2, 2, 65, 66, 67, 5, 68, 69, 2, 2, 2,
-	},
-	{
-		2, 2, 70, 71, 2, 72, 13, 73, 74, 75, 2, 2, 2, 2, 2, 2,
-		76, 76, 76, 76, 76, 76, 77, 77, 77, 77, 78, 79, 79, 79, 79, 79,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 70, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-	},
-	{
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 80, 2, 81, 2, 31, 2, 31, 2, 2, 2, 82, 83, 20, 2, 2,
-	},
-	{
-		84, 2, 2, 2, 2, 2, 2, 2, 49, 2, 85, 2, 2, 2, 2, 2,
-		2, 2, 86, 87, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 88, 2, 2, 2, 89, 90, 91, 2, 2, 2, 5, 92, 2, 2, 2,
-		93, 2, 2, 94, 95, 2, 12, 96, 97, 2, 98, 2, 2, 2, 99, 53,
-	},
-	{
-		2, 2, 100, 101, 2, 2, 2, 2, 2, 2, 2, 2, 2, 102, 103, 104,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 5, 5, 5, 5,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-	},
-	{
-		105, 2, 106, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 5, 5, 13,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-	},
-	{
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-	},
-	{
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 107, 108,
-		2, 2, 2, 2, 2, 2, 2, 107, 2, 2, 2, 2, 2, 2, 5, 5,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-	},
-	{
-		2, 2, 25, 2, 2, 2, 2, 2, 2, 109, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-	},
-	{
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 107, 110, 2, 111, 2, 2, 2, 2, 2, 108,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-	},
-	{
-		112, 2, 113, 2, 2, 2, 2, 2, 114, 2, 2, 115, 116, 2, 5, 117,
-		2, 2, 118, 2, 119, 53, 76, 120, 27, 2, 2, 121, 122, 2, 123, 2,
-		2, 2, 124, 125, 126, 2, 2, 127, 2, 2, 2, 128, 17, 2, 129, 130,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 131, 2,
-	},
-	{
-		132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133,
-		134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135,
-		134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136,
-		134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132,
-	},
-	{
-		133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134,
-		135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134,
-		136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134,
-		132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133,
-	},
-	{
-		134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135,
-		134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136,
-		134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132,
-		133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134,
-	},
-	{
-		135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134,
-		136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134,
-		132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133,
-		134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135,
-	},
-	{
-		134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136,
-		134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132,
-		133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134,
-		135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134,
-	},
-	{
-		136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134,
-		132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133,
-		134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135,
-		134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136,
-	},
-	{
-		134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132,
-		133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134,
-		135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134,
-		136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134,
-	},
-	{
-		135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134,
-		136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134,
-		132, 133, 134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 136, 134, 132, 133,
-		134, 135, 134, 136, 134, 132, 133, 134, 135, 134, 137, 77, 138, 79, 79, 139,
-	},
-	{
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 36, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-	},
-	{
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		5, 2, 5, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 111, 2, 2, 2, 2, 2, 140,
-	},
-	{
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 75,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 13, 2,
-		2, 2, 2, 2, 2, 2, 2, 141, 2, 2, 2, 2, 2, 2, 2, 2,
-	},
-	{
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		142, 2, 2, 143, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 49, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-	},
-	{
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 144, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 145, 2, 2, 2, 2, 70,
-		2, 2, 2, 2, 19, 13, 2, 2, 146, 2, 2, 2, 2, 2, 2, 2,
-	},
-	{
-		147, 2, 2, 148, 149, 2, 2, 150, 97, 2, 2, 151, 152, 2, 2, 2,
-		153, 2, 154, 155, 156, 2, 2, 157, 97, 2, 2, 158, 159, 2, 2, 2,
-		2, 2, 160, 161, 17, 2, 2, 2, 2, 2, 2, 2, 2, 107, 162, 2,
-		53, 2, 2, 54, 163, 35, 164, 155, 2, 2, 2, 2, 2, 2, 2, 2,
-	},
-	{
-		2, 2, 2, 165, 166, 36, 2, 2, 2, 2, 2, 167, 168, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 107, 169, 13, 170, 2, 2,
-		2, 2, 2, 171, 13, 2, 2, 2, 2, 2, 172, 173, 2, 2, 2, 2,
-		2, 70, 174, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-	},
-	{
-		2, 2, 160, 175, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 176, 177, 2, 2, 2, 2, 2, 2, 2, 2, 178, 179, 2,
-		180, 2, 2, 181, 35, 182, 2, 2, 183, 184, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-	},
-	{
-		2, 2, 185, 186, 2, 2, 2, 2, 2, 187, 188, 189, 2, 2, 2, 2,
-		2, 2, 2, 190, 191, 2, 2, 2, 192, 193, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 194,
-		195, 2, 2, 196, 197, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-	},
-	{
-		2, 2, 2, 1, 198, 199, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-	},
-	{
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 155,
-		2, 2, 2, 149, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-	},
-	{
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 107, 200, 201, 201, 202, 153, 2, 2, 2, 2, 203, 114,
-	},
-	{
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 204, 205, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-	},
-	{
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		5, 5, 206, 5, 149, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-	},
-	{
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 207, 208, 209, 2, 210, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 211, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-	},
-	{
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		5, 5, 5, 212, 5, 5, 68, 123, 203, 12, 7, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-	},
-	{
-		213, 214, 215, 2, 2, 2, 2, 2, 107, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 149, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 36, 2, 2, 2, 216, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-	},
-	{
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 216, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-	},
-	{
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 149, 2, 2,
-		2, 2, 2, 2, 217, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-	},
-	{
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 218, 219,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 12,
-	},
-	{
-		1, 1, 5, 5, 5, 5, 5, 5, 1, 1, 1, 1, 1, 1, 1, 1,
-		5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 1,
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-	},
-	{
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+/* 29952 bytes. */
+static const uint8_t unicode_props[][128] = {
+	{
+		0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x08, 0x0c, 0x0c, 0x04, 0x0c, 0x0c,
+		0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0c,
+	},
+	{
+		0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+		0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0d, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x10,
+		0x01, 0x10, 0x10, 0x01, 0x10, 0x10, 0x01, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x0c, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x18, 0x01, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x10, 0x10, 0x01, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x18,
+		0x01, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x01, 0x10, 0x10, 0x10, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x18, 0x18, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	},
+	{
+		0x10, 0x10, 0x10, 0x1d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x1d, 0x10, 0x01, 0x1d, 0x1d,
+		0x1d, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1d, 0x1d, 0x1d, 0x1d, 0x10, 0x1d, 0x1d,
+		0x01, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x10, 0x1d, 0x1d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x01, 0x11, 0x1d,
+		0x1d, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x1d, 0x1d, 0x01, 0x01, 0x1d, 0x1d, 0x10, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x11, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x01,
+	},
+	{
+		0x01, 0x10, 0x10, 0x1d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x01, 0x1d, 0x1d,
+		0x1d, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x01, 0x01, 0x10, 0x10, 0x10, 0x01, 0x01,
+		0x01, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x10, 0x10, 0x01, 0x01, 0x01, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x10, 0x10, 0x1d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x01, 0x1d, 0x1d,
+		0x1d, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x10, 0x10, 0x1d, 0x01, 0x1d, 0x1d, 0x10, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	},
+	{
+		0x01, 0x10, 0x1d, 0x1d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x01, 0x11, 0x10,
+		0x1d, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x1d, 0x1d, 0x01, 0x01, 0x1d, 0x1d, 0x10, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x11, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x11, 0x1d,
+		0x10, 0x1d, 0x1d, 0x01, 0x01, 0x01, 0x1d, 0x1d, 0x1d, 0x01, 0x1d, 0x1d, 0x1d, 0x10, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x11, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x10, 0x1d, 0x1d, 0x1d, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x01, 0x10, 0x10,
+		0x10, 0x1d, 0x1d, 0x1d, 0x1d, 0x01, 0x10, 0x10, 0x10, 0x01, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x10, 0x1d, 0x1d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x01, 0x1d, 0x10,
+		0x1d, 0x1d, 0x11, 0x1d, 0x1d, 0x01, 0x10, 0x1d, 0x1d, 0x01, 0x1d, 0x1d, 0x10, 0x10, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x11, 0x11, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x1d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x10, 0x10, 0x1d, 0x1d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x01, 0x11, 0x1d,
+		0x1d, 0x10, 0x10, 0x10, 0x10, 0x01, 0x1d, 0x1d, 0x1d, 0x01, 0x1d, 0x1d, 0x1d, 0x10, 0x19, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x11, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x10, 0x1d, 0x1d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x01, 0x01, 0x01, 0x01, 0x11,
+		0x1d, 0x1d, 0x10, 0x10, 0x10, 0x01, 0x10, 0x01, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x11,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x1d, 0x1d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x10, 0x01, 0x1d, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x10, 0x01, 0x1d, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x01, 0x01, 0x01, 0x1d, 0x1d,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1d,
+	},
+	{
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10,
+		0x10, 0x1d, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x10, 0x10, 0x1d, 0x1d, 0x10, 0x10, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1d, 0x1d, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10,
+		0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x10, 0x01, 0x1d, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+		0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+		0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+		0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+		0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+		0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+		0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+		0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+	},
+	{
+		0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+		0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+		0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+		0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+		0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+		0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+		0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+		0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x10, 0x10, 0x10, 0x1d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x10, 0x10, 0x1d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x1d, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1d, 0x1d,
+		0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x10, 0x1d, 0x1d, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x0c, 0x10,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x10, 0x10, 0x10, 0x1d, 0x1d, 0x1d, 0x1d, 0x10, 0x10, 0x1d, 0x1d, 0x1d, 0x01, 0x01, 0x01, 0x01,
+		0x1d, 0x1d, 0x10, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x1d, 0x1d, 0x10, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x1d, 0x10, 0x1d, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01,
+		0x10, 0x01, 0x10, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1d, 0x1d, 0x1d,
+		0x1d, 0x1d, 0x1d, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x10,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x10, 0x10, 0x10, 0x10, 0x1d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x10, 0x11, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1d, 0x10, 0x1d, 0x1d, 0x1d,
+		0x1d, 0x1d, 0x10, 0x1d, 0x1d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x10, 0x10, 0x1d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x1d, 0x10, 0x10, 0x10, 0x10, 0x1d, 0x1d, 0x10, 0x10, 0x1d, 0x10, 0x10, 0x10, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x1d, 0x10, 0x10, 0x1d, 0x1d, 0x1d, 0x10, 0x1d, 0x10,
+		0x10, 0x10, 0x1d, 0x1d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x1d, 0x1d, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x10, 0x10, 0x10, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x1d, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x10, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x10, 0x01, 0x01, 0x1d, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0c, 0x10, 0x34, 0x0c, 0x0c,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0d, 0x0d, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0d, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01,
+		0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x02, 0x02, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x01,
+		0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10,
+		0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	},
+	{
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	},
+	{
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x10, 0x10, 0x10, 0x10, 0x12, 0x12,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01,
+		0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	},
+	{
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x10, 0x10, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	},
+	{
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	},
+	{
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	},
+	{
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10,
+		0x10, 0x10, 0x10, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x10, 0x01, 0x01, 0x01, 0x10, 0x01, 0x01, 0x01, 0x01, 0x10, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x1d, 0x1d, 0x10, 0x10, 0x1d, 0x01, 0x01, 0x01, 0x01, 0x10, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x1d, 0x1d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
+		0x1d, 0x1d, 0x1d, 0x1d, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x1d, 0x1d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+		0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x01, 0x01, 0x01,
+	},
+	{
+		0x10, 0x10, 0x10, 0x1d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x10, 0x1d, 0x1d, 0x10, 0x10, 0x10, 0x10, 0x1d, 0x1d, 0x10, 0x10, 0x1d, 0x1d,
+		0x1d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1d,
+		0x1d, 0x10, 0x10, 0x1d, 0x1d, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x1d, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x10, 0x01, 0x10, 0x10, 0x10, 0x01, 0x01, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10,
+		0x01, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1d, 0x10, 0x10, 0x1d, 0x1d,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x1d, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x1d, 0x1d, 0x10, 0x1d, 0x1d, 0x10, 0x1d, 0x1d, 0x01, 0x1d, 0x10, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x2e, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+		0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x2e, 0x32, 0x32, 0x32,
+		0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+		0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x2e, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+		0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+		0x32, 0x32, 0x32, 0x32, 0x2e, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+		0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+		0x2e, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+	},
+	{
+		0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x2e, 0x32, 0x32, 0x32,
+		0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+		0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x2e, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+		0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+		0x32, 0x32, 0x32, 0x32, 0x2e, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+		0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+		0x2e, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+		0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x2e, 0x32, 0x32, 0x32,
+	},
+	{
+		0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+		0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x2e, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+		0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+		0x32, 0x32, 0x32, 0x32, 0x2e, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+		0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+		0x2e, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+		0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x2e, 0x32, 0x32, 0x32,
+		0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+	},
+	{
+		0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x2e, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+		0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+		0x32, 0x32, 0x32, 0x32, 0x2e, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+		0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+		0x2e, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+		0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x2e, 0x32, 0x32, 0x32,
+		0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+		0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x2e, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+	},
+	{
+		0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+		0x32, 0x32, 0x32, 0x32, 0x2e, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+		0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+		0x2e, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+		0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x2e, 0x32, 0x32, 0x32,
+		0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+		0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x2e, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+		0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+	},
+	{
+		0x32, 0x32, 0x32, 0x32, 0x2e, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+		0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+		0x2e, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+		0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x2e, 0x32, 0x32, 0x32,
+		0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+		0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x2e, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+		0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+		0x32, 0x32, 0x32, 0x32, 0x2e, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+	},
+	{
+		0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+		0x2e, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+		0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x2e, 0x32, 0x32, 0x32,
+		0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+		0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x2e, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+		0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+		0x32, 0x32, 0x32, 0x32, 0x2e, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+		0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+	},
+	{
+		0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x2e, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+		0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+		0x32, 0x32, 0x32, 0x32, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+		0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x01, 0x01, 0x01, 0x01, 0x29, 0x29, 0x29, 0x29, 0x29,
+		0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+		0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+		0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0c,
+	},
+	{
+		0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x11, 0x11,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0c, 0x0c, 0x0c, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x10, 0x10, 0x10, 0x01, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x10,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x1d, 0x10, 0x1d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x10, 0x01, 0x01, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10,
+	},
+	{
+		0x10, 0x10, 0x1d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x1d, 0x1d, 0x1d, 0x10, 0x10, 0x10, 0x10, 0x1d, 0x1d, 0x10, 0x10, 0x01, 0x01, 0x18, 0x01, 0x01,
+		0x01, 0x01, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x18, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x10, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1d, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x1d, 0x1d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x10, 0x10, 0x1d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x1d, 0x1d, 0x1d, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1d,
+		0x1d, 0x01, 0x19, 0x19, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x01, 0x1d, 0x10,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1d, 0x1d, 0x1d, 0x10,
+		0x10, 0x10, 0x1d, 0x1d, 0x10, 0x1d, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x01,
+		0x01, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10,
+		0x1d, 0x1d, 0x1d, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x10, 0x10, 0x1d, 0x1d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x01, 0x11, 0x1d,
+		0x10, 0x1d, 0x1d, 0x1d, 0x1d, 0x01, 0x01, 0x1d, 0x1d, 0x01, 0x01, 0x1d, 0x1d, 0x1d, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x11, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x1d, 0x1d, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x1d, 0x1d, 0x1d, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x1d, 0x1d, 0x10, 0x10, 0x10, 0x1d, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x11, 0x1d, 0x1d, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1d, 0x10, 0x1d, 0x1d, 0x11, 0x1d, 0x10,
+		0x10, 0x1d, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x11,
+		0x1d, 0x1d, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x1d, 0x1d, 0x1d, 0x1d, 0x10, 0x10, 0x1d, 0x10,
+		0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x1d, 0x1d, 0x1d, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1d, 0x1d, 0x10, 0x1d, 0x10,
+		0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x1d, 0x10, 0x1d, 0x1d,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1d, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10,
+		0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x1d, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1d, 0x1d, 0x1d, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1d, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x11, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x01, 0x1d, 0x1d, 0x01, 0x01, 0x10, 0x10, 0x1d, 0x10, 0x19,
+		0x1d, 0x19, 0x1d, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x1d, 0x1d, 0x1d, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x10, 0x10, 0x1d, 0x1d, 0x1d, 0x1d,
+		0x10, 0x01, 0x01, 0x01, 0x1d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1d, 0x19, 0x10, 0x10, 0x10, 0x10, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1d, 0x1d, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1d, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1d,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1d, 0x10,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x1d, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x1d, 0x10, 0x10, 0x1d, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01, 0x10, 0x01, 0x10, 0x10, 0x01, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x19, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x01,
+		0x10, 0x10, 0x01, 0x1d, 0x1d, 0x10, 0x1d, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x10, 0x10, 0x1d, 0x1d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x10, 0x10, 0x19, 0x1d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x1d, 0x1d, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01, 0x1d, 0x1d,
+		0x10, 0x1d, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+		0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10,
+		0x01, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
+		0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
+		0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
+	},
+	{
+		0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10,
+		0x10, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x02, 0x02, 0x02, 0x02, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x1e, 0x1e, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x01,
+	},
+	{
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x02, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	},
+	{
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x01,
+		0x0c, 0x0c, 0x0c, 0x0c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x11, 0x1d, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01, 0x1d, 0x11, 0x11,
+		0x11, 0x11, 0x11, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x10, 0x10, 0x10, 0x10, 0x10,
+	},
+	{
+		0x10, 0x10, 0x10, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x01, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x01, 0x10, 0x10, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01,
+		0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
+		0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
+	},
+	{
+		0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02,
+	},
+	{
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x12, 0x12, 0x12, 0x12, 0x12,
+	},
+	{
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01,
+		0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	},
+	{
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x02,
+	},
+	{
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02,
+	},
+	{
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01,
+		0x02, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01,
+		0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01,
+	},
+	{
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01,
+	},
+	{
+		0x0d, 0x0c, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+		0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	},
+	{
+		0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+		0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+		0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+		0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+		0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+		0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+		0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+		0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+	},
+	{
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	},
+	{
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
 	},
 };
 
-static const uint8_t grapheme_break0[] = {
-	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 9, 10, 11, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 12, 13, 14, 15, 16, 17, 18,
-	19, 20, 14, 15, 16, 21, 9, 9, 9, 9, 9, 9, 9, 9, 22, 23,
-	24, 9, 25, 26, 27, 28, 29, 30, 9, 9, 9, 9, 9, 31, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 32, 33, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 34,
-	9, 9, 9, 35, 36, 9, 37, 9, 38, 39, 40, 9, 41, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	42, 43, 43, 43, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+static const uint8_t unicode_props_index[] = {
+	0, 1, 2, 2, 2, 2, 3, 2, 2, 4, 2, 5, 6, 7, 8, 9,
+	10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25,
+	26, 27, 28, 29, 2, 2, 30, 2, 2, 2, 2, 2, 2, 2, 31, 32,
+	33, 34, 35, 2, 36, 37, 38, 39, 40, 41, 2, 42, 2, 2, 2, 2,
+	43, 44, 2, 2, 2, 2, 45, 46, 2, 2, 2, 47, 48, 49, 50, 51,
+	2, 2, 2, 2, 2, 2, 52, 2, 2, 53, 54, 55, 2, 56, 57, 58,
+	59, 60, 61, 62, 63, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 64, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 65, 2, 2, 66, 67, 2, 2,
+	68, 69, 70, 71, 72, 73, 2, 74, 75, 76, 77, 78, 79, 80, 81, 75,
+	76, 77, 78, 79, 80, 81, 75, 76, 77, 78, 79, 80, 81, 75, 76, 77,
+	78, 79, 80, 81, 75, 76, 77, 78, 79, 80, 81, 75, 76, 77, 78, 79,
+	80, 81, 75, 76, 77, 78, 79, 80, 81, 75, 76, 77, 78, 79, 80, 81,
+	75, 76, 77, 78, 79, 80, 81, 75, 76, 77, 78, 79, 80, 81, 75, 76,
+	77, 78, 79, 80, 81, 75, 76, 77, 78, 79, 80, 81, 75, 76, 77, 82,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 57, 57, 57, 57, 83, 2, 2, 2, 2, 2, 84, 85, 86, 87,
+	2, 2, 2, 88, 2, 89, 90, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 91, 92, 2, 2, 2, 2, 93, 2, 2, 94, 95, 96,
+	97, 98, 99, 100, 101, 102, 103, 2, 104, 105, 2, 106, 107, 108, 109, 2,
+	110, 2, 111, 112, 113, 114, 2, 2, 115, 116, 117, 118, 2, 119, 120, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 121, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 122, 123, 2, 2, 2, 2, 2, 2, 2, 124, 125,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 126,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 127, 128, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 129,
+	57, 57, 130, 57, 57, 131, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 132, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 133, 2,
+	2, 2, 134, 135, 136, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 137, 138, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	139, 140, 123, 2, 2, 141, 2, 2, 2, 142, 2, 2, 2, 2, 2, 2,
+	2, 143, 144, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	145, 146, 2, 147, 148, 2, 149, 150, 151, 152, 153, 154, 155, 156, 2, 157,
+	2, 2, 158, 57, 159, 160, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 161,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+	57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 161,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	162, 163, 164, 165, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163,
+	163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
 };
 
-static const int grapheme_break0_shift = 10;
-static const int grapheme_break1_shift = 4;
-static const int grapheme_break2_shift = 1;
-static const int grapheme_break1_mask = 0x3f;
-static const int grapheme_break2_mask = 0x7;
-static const int grapheme_break3_mask = 0x1;
-static const int grapheme_break_val_shift = 4;
-static const int grapheme_break_val_mask = 0xf;
+static const int unicode_props_shift = 7;
+static const int unicode_props_mask = 0x7f;
+static const int unicode_props_width_mask = 0x3;
+static const int unicode_props_break_shift = 2;
@@ -1,27 +1,58 @@
-#!/usr/bin/env python
-# Build multi-stage lookup tables for character widths and grapheme break properties
+#!/usr/bin/env python3
+# Build the lookup table for character widths and grapheme break properties.
+#
+# The data is read from the copy of the Unicode Character Database in the
+# directory given (utf8data by default), so that the table only changes when
+# those files are updated. To move to a new version of Unicode, replace them
+# with the files for that version and update UNICODE_VERSION.
+#
+# Each codepoint's width and grapheme break class are packed into one byte,
+# held in a two stage table: the codepoint's block is looked up in an index,
+# then the codepoint in the block. Identical blocks are only stored once.
+import os
 import re
-
-CatCode = dict()
-with open('UnicodeData.txt') as f:
-    for line in f.readlines():
-        tokens = line.split(';')
-        if len(tokens) < 3:
-            continue
-
-        c = int(tokens[0], 16)
-        if re.match('^<.*, First>$', tokens[1]):
-            start = c
-        elif re.match('^<.*, Last>$', tokens[1]):
-            end = c
-            for c in range(start, end + 1):
-                CatCode[c] = tokens[2]
-        else:
-            CatCode[c] = tokens[2]
-
-EastAsianWidth = dict()
-with open('EastAsianWidth.txt') as f:
-    for line in f.readlines():
+import sys
+
+UNICODE_VERSION = '15.0.0'
+
+BREAK_CLASSES = [
+    'Other',
+    'CR',
+    'LF',
+    'Control',
+    'Extend',
+    'Regional_Indicator',
+    'Prepend',
+    'SpacingMark',
+    'L',
+    'V',
+    'T',
+    'LV',
+    'LVT',
+    'ZWJ',
+]
+
+WIDTH_BITS = 2
+CODEPOINT_COUNT = 0x110000
+
+data_dir = sys.argv[1] if len(sys.argv) > 1 else os.path.join(os.path.dirname(__file__), 'utf8data')
+
+
+def data_file(name, versioned=True):
+    path = os.path.join(data_dir, name)
+    with open(path, encoding='utf-8') as f:
+        lines = f.readlines()
+    if versioned:
+        # These files name their version on the first line, e.g.
+        # "# EastAsianWidth-15.0.0.txt".
+        expected = '# %s-%s.txt' % (os.path.splitext(name)[0], UNICODE_VERSION)
+        if not lines or lines[0].strip() != expected:
+            sys.exit('%s is not for Unicode %s' % (path, UNICODE_VERSION))
+    return lines
+
+
+def ranges(lines):
+    for line in lines:
         tokens = line.split('#')[0].split(';')
         if len(tokens) < 2:
             continue
@@ -33,30 +64,37 @@ with open('EastAsianWidth.txt') as f:
         else:
             end = start
 
-        width = tokens[1].strip()
-        for c in range(start, end + 1):
-            if width=='W' or width=='F':
-                EastAsianWidth[c] = 2
-            elif width=='Na' or width=='H':
-                EastAsianWidth[c] = 1
+        yield start, end, tokens[1].strip()
 
-GraphemeBreak = dict()
-with open('GraphemeBreakProperty.txt') as f:
-    for line in f.readlines():
-        tokens = line.split('#')[0].split(';')
-        if len(tokens) < 2:
-            continue
 
-        rangetokens = tokens[0].split('..')
-        start = int(rangetokens[0], 16)
-        if len(rangetokens) > 1:
-            end = int(rangetokens[1], 16)
-        else:
-            end = start
+CatCode = dict()
+for line in data_file('UnicodeData.txt', versioned=False):
+    tokens = line.split(';')
+    if len(tokens) < 3:
+        continue
+
+    c = int(tokens[0], 16)
+    if re.match('^<.*, First>$', tokens[1]):
+        start = c
+    elif re.match('^<.*, Last>$', tokens[1]):
+        for c in range(start, c + 1):
+            CatCode[c] = tokens[2]
+    else:
+        CatCode[c] = tokens[2]
+
+EastAsianWidth = dict()
+for start, end, width in ranges(data_file('EastAsianWidth.txt')):
+    for c in range(start, end + 1):
+        if width == 'W' or width == 'F':
+            EastAsianWidth[c] = 2
+        elif width == 'Na' or width == 'H':
+            EastAsianWidth[c] = 1
+
+GraphemeBreak = dict()
+for start, end, b in ranges(data_file('GraphemeBreakProperty.txt')):
+    for c in range(start, end + 1):
+        GraphemeBreak[c] = b
 
-        b = tokens[1].strip()
-        for c in range(start, end + 1):
-            GraphemeBreak[c] = b
 
 def width(c):
     if c == 0x00ad:
@@ -66,87 +104,68 @@ def width(c):
         return 0
     return EastAsianWidth.get(c, 1)
 
+
 def grapheme_break(c):
-    return GraphemeBreak.get(c, 'Other')
-
-class LookupTable(object):
-    def __init__(self, label, row_len, val_bits, display_val):
-        self.label = label
-        self.row_len = row_len
-        self.val_len = 1 << val_bits
-        self.val_shift = 8 / self.val_len
-        self.display_val = display_val
-        self.blocks = []
-
-    def append(self, block):
-        try:
-            index = self.blocks.index(block)
-        except ValueError:
-            index = len(self.blocks)
-            self.blocks.append(block)
-        return index
-
-    def display(self):
-        print 'static const uint8_t %s[][%d] = {' % (self.label, len(self.blocks[0])/self.val_len)
-        for block in self.blocks:
-            self.display_block(block)
-        print '};\n'
-
-    def display_block(self, block):
-        print '\t{'
-        for i in range(0, len(block), self.row_len):
-            self.display_row(block[i:i+self.row_len])
-        print '\t},'
-
-    def display_row(self, row):
-        vals = []
-        for i in range(0, len(row), self.val_len):
-            vals.append(self.display_val(row[i:i+self.val_len], self.val_shift))
-        print '\t\t' + ', '.join(vals) + ','
-
-def display_index(val, val_shift):
-    return '%d' % sum([v << (i * val_shift) for i,v in enumerate(val)])
-
-def display_width(val, val_shift):
-    return '0x%02X' % sum([v << (i * val_shift) for i,v in enumerate(val)])
-
-def display_grapheme_break(val, val_shift):
-    return ' | '.join(['(UTF8_GRAPHEME_BREAK_' + v.upper() + ' << ' + str(i * val_shift) + ')' for i,v in enumerate(val)])
-
-def display_index_table(label, val):
-    print 'static const uint8_t ' + label + '[] = {'
-    for i in range(0, len(val), 0x10):
-        print '\t' + ', '.join(map(str, val[i:i+0x10])) + ','
-    print '};\n'
-
-def table(label, f, display, row_len, count, block1_bits, block2_bits, val_bits):
-    val_shift = 8 / (1 << val_bits)
-    table1 = LookupTable(label + str(1), 16, 0, display_index)
-    table2 = LookupTable(label + str(2), row_len, val_bits, display)
-    block1_len = 1 << (block1_bits + block2_bits + val_bits);
-    block2_len = 1 << (block2_bits + val_bits);
-    indextable = []
-    for i in range(0, count, block1_len):
-        block1 = []
-        for j in range(0, block1_len, block2_len):
-            block2 = []
-            for c in range(block2_len):
-                block2.append(f(i + j + c))
-            block1.append(table2.append(block2))
-        indextable.append(table1.append(block1))
-
-    table2.display()
-    table1.display()
-    display_index_table(label + str(0), indextable)
-    print 'static const int %s0_shift = %d;' % (label, block1_bits + block2_bits + val_bits)
-    print 'static const int %s1_shift = %d;' % (label, block2_bits + val_bits)
-    print 'static const int %s2_shift = %d;' % (label, val_bits)
-    print 'static const int %s1_mask = 0x%x;' % (label, (1 << block1_bits) - 1)
-    print 'static const int %s2_mask = 0x%x;' % (label, (1 << block2_bits) - 1)
-    print 'static const int %s3_mask = 0x%x;' % (label, (1 << val_bits) - 1)
-    print 'static const int %s_val_shift = %d;' % (label, val_shift)
-    print 'static const int %s_val_mask = 0x%x;' % (label, (1 << val_shift) - 1)
-
-table('width', width, display_width, 32, 0x110000, 5, 3, 2)
-print ''
-table('grapheme_break', grapheme_break, display_grapheme_break, 2, 0x110000, 6, 3, 1)
+    return BREAK_CLASSES.index(GraphemeBreak.get(c, 'Other'))
+
+
+def props(c):
+    return width(c) | (grapheme_break(c) << WIDTH_BITS)
+
+
+def split(values, block_bits):
+    block_len = 1 << block_bits
+    blocks = []
+    block_index = dict()
+    index = []
+    for i in range(0, len(values), block_len):
+        block = tuple(values[i:i + block_len])
+        if block not in block_index:
+            block_index[block] = len(blocks)
+            blocks.append(block)
+        index.append(block_index[block])
+    return blocks, index
+
+
+def table_size(blocks, index):
+    index_size = 1 if len(blocks) <= 0x100 else 2
+    return len(blocks) * len(blocks[0]) + len(index) * index_size
+
+
+values = [props(c) for c in range(CODEPOINT_COUNT)]
+
+# Use the block size that gives the smallest table.
+block_bits = min(range(4, 12), key=lambda bits: table_size(*split(values, bits)))
+blocks, index = split(values, block_bits)
+index_type = 'uint8_t' if len(blocks) <= 0x100 else 'uint16_t'
+
+print('/*')
+print(' * Generated by utf8data.py from the Unicode %s character database.' % UNICODE_VERSION)
+print(' * Do not edit.')
+print(' */')
+print('')
+print('#define UTF8DATA_UNICODE_VERSION "%s"' % UNICODE_VERSION)
+print('')
+print('enum {')
+for b in BREAK_CLASSES:
+    print('\tUTF8_GRAPHEME_BREAK_%s,' % b.upper())
+print('};')
+print('')
+print('/* %d bytes. */' % table_size(blocks, index))
+print('static const uint8_t unicode_props[][%d] = {' % (1 << block_bits))
+for block in blocks:
+    print('\t{')
+    for i in range(0, len(block), 16):
+        print('\t\t' + ', '.join('0x%02x' % v for v in block[i:i + 16]) + ',')
+    print('\t},')
+print('};')
+print('')
+print('static const %s unicode_props_index[] = {' % index_type)
+for i in range(0, len(index), 16):
+    print('\t' + ', '.join(str(v) for v in index[i:i + 16]) + ',')
+print('};')
+print('')
+print('static const int unicode_props_shift = %d;' % block_bits)
+print('static const int unicode_props_mask = 0x%x;' % ((1 << block_bits) - 1))
+print('static const int unicode_props_width_mask = 0x%x;' % ((1 << WIDTH_BITS) - 1))
+print('static const int unicode_props_break_shift = %d;' % WIDTH_BITS)
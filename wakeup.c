@@ -0,0 +1,83 @@
+#include "wakeup.h"
+#include "export.h"
+#include "io.h"
+
+#include <errno.h>
+#include <stdint.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+NO_EXPORT
+void
+wakeup_init(struct wakeup * const wakeup)
+{
+	wakeup->fd = -1;
+}
+
+NO_EXPORT
+bool
+wakeup_open(struct wakeup * const wakeup)
+{
+	if (__atomic_load_n(&wakeup->fd, __ATOMIC_ACQUIRE) != -1) {
+		return true;
+	}
+
+	int const fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+	int expected = -1;
+
+	if (fd == -1) {
+		return false;
+	}
+	/* Another thread may have got here first. */
+	if (!__atomic_compare_exchange_n(&wakeup->fd,
+					 &expected,
+					 fd,
+					 false,
+					 __ATOMIC_ACQ_REL,
+					 __ATOMIC_ACQUIRE)) {
+		close(fd);
+	}
+
+	return true;
+}
+
+NO_EXPORT
+void
+wakeup_close(struct wakeup * const wakeup)
+{
+	if (wakeup->fd != -1) {
+		close(wakeup->fd);
+	}
+	wakeup_init(wakeup);
+}
+
+NO_EXPORT
+int
+wakeup_fd(struct wakeup const * const wakeup)
+{
+	return __atomic_load_n(&wakeup->fd, __ATOMIC_ACQUIRE);
+}
+
+NO_EXPORT
+void
+wakeup_signal(struct wakeup const * const wakeup)
+{
+	int const fd = wakeup_fd(wakeup);
+	uint64_t const one = 1;
+
+	if (fd != -1 && io_write(fd, &one, sizeof one) == -1) {
+		/* The count is saturated, so a wakeup is already pending. */
+	}
+}
+
+NO_EXPORT
+void
+wakeup_drain(struct wakeup const * const wakeup)
+{
+	int const fd = wakeup_fd(wakeup);
+	uint64_t count;
+
+	if (fd != -1 && io_read(fd, &count, sizeof count) == -1) {
+		/* Nothing was pending. */
+	}
+}
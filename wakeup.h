@@ -0,0 +1,33 @@
+#pragma once
+
+#include <stdbool.h>
+
+/*
+ * An eventfd that wakes up an instance waiting for input, which can be
+ * opened and signalled from any thread. It is only opened once something
+ * needs it.
+ */
+struct wakeup {
+	int fd;
+};
+
+void
+wakeup_init(struct wakeup *wakeup);
+
+/* Open the eventfd if it isn't already. Return true if successful, else false. */
+bool
+wakeup_open(struct wakeup *wakeup);
+
+void
+wakeup_close(struct wakeup *wakeup);
+
+/* The fd to poll, or -1 if it isn't open. */
+int
+wakeup_fd(struct wakeup const *wakeup);
+
+void
+wakeup_signal(struct wakeup const *wakeup);
+
+/* Discard any wakeups, once the fd has been found to be readable. */
+void
+wakeup_drain(struct wakeup const *wakeup);